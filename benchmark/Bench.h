@@ -0,0 +1,132 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Common helpers of the benchmark applications.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "ublox/MsgId.h"
+
+namespace bench
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Prevent the compiler from optimising away the value.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* Sink = nullptr;
+    Sink = &value;
+#endif
+}
+
+/// @brief Measure average duration of the operation in nanoseconds.
+/// @details The operation is invoked once to warm up the caches, then
+///     in growing batches (to amortise the clock reading) until at least
+///     @b minDuration has passed.
+template <typename TFunc>
+double measureNs(TFunc&& func, std::chrono::milliseconds minDuration = std::chrono::milliseconds(200))
+{
+    static const std::size_t MaxBatch = 1024U * 1024U;
+
+    func();
+    std::size_t count = 0U;
+    std::size_t batch = 1U;
+    auto start = Clock::now();
+    auto elapsed = Clock::duration();
+    do {
+        for (auto idx = 0U; idx < batch; ++idx) {
+            func();
+        }
+
+        count += batch;
+        batch = std::min(batch * 2U, MaxBatch);
+        elapsed = Clock::now() - start;
+    } while (elapsed < minDuration);
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / count;
+}
+
+/// @brief Print single result line.
+/// @param[in] name Name of the measured operation.
+/// @param[in] ns Duration of single operation in nanoseconds.
+/// @param[in] bytes Number of bytes processed by single operation, 0 if not applicable.
+/// @param[in] items Number of items (frames, messages) processed by single operation.
+inline void report(const char* name, double ns, std::size_t bytes, std::size_t items = 1U)
+{
+    std::printf("%-44s %12.1f ns", name, ns);
+    if (1U < items) {
+        std::printf(" %10.2f Mitems/s", (items * 1000.0) / ns);
+    }
+
+    if (0U < bytes) {
+        std::printf(" %9.1f MB/s", (bytes * 1000.0) / ns);
+    }
+    std::printf("\n");
+}
+
+/// @brief Generate random payload.
+inline std::vector<std::uint8_t> randomPayload(std::size_t len, unsigned seed = 0U)
+{
+    std::mt19937 gen(seed);
+    std::vector<std::uint8_t> result(len);
+    for (auto& byte : result) {
+        byte = static_cast<std::uint8_t>(gen());
+    }
+    return result;
+}
+
+/// @brief Append full UBX frame with specified payload to the buffer.
+inline void appendFrame(std::vector<std::uint8_t>& buf, ublox::MsgId id, const std::vector<std::uint8_t>& payload)
+{
+    auto from = buf.size();
+    auto idValue = static_cast<unsigned>(id);
+    auto len = payload.size();
+    buf.push_back(0xb5);
+    buf.push_back(0x62);
+    buf.push_back(static_cast<std::uint8_t>(idValue >> 8U));
+    buf.push_back(static_cast<std::uint8_t>(idValue));
+    buf.push_back(static_cast<std::uint8_t>(len));
+    buf.push_back(static_cast<std::uint8_t>(len >> 8U));
+    buf.insert(buf.end(), payload.begin(), payload.end());
+
+    std::uint8_t ckA = 0U;
+    std::uint8_t ckB = 0U;
+    for (auto idx = from + 2U; idx < buf.size(); ++idx) {
+        ckA = static_cast<std::uint8_t>(ckA + buf[idx]);
+        ckB = static_cast<std::uint8_t>(ckB + ckA);
+    }
+    buf.push_back(ckA);
+    buf.push_back(ckB);
+}
+
+}  // namespace bench
+
@@ -0,0 +1,132 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Generation of the synthetic receiver output used by the benchmarks.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "ublox/Message.h"
+#include "ublox/FrameWriter.h"
+#include "ublox/FrameSplitter.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavDop.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/message/NavTimeutc.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/message/RxmRawx.h"
+
+namespace bench
+{
+
+/// @brief Append the frame of the message to the buffer.
+template <typename TMsg>
+void appendMessage(std::vector<std::uint8_t>& buf, const TMsg& msg)
+{
+    auto iter = std::back_inserter(buf);
+    auto es = ublox::writeFrame(msg, iter);
+    static_cast<void>(es);
+    GASSERT(es == comms::ErrorStatus::Success);
+}
+
+/// @brief Generate the capture of the receiver output.
+/// @details Every navigation epoch consists of NAV-PVT, NAV-POSLLH,
+///     NAV-VELNED, NAV-DOP, NAV-CLOCK, NAV-TIMEUTC, NAV-SAT and RXM-RAWX
+///     messages, i.e. mix of short fixed length and long variable length frames.
+/// @param[in] epochs Number of the navigation epochs.
+/// @param[in] numSvs Number of the satellites reported in NAV-SAT.
+/// @param[in] numMeas Number of the measurements reported in RXM-RAWX.
+inline std::vector<std::uint8_t> makeCapture(std::size_t epochs, std::size_t numSvs = 24U, std::size_t numMeas = 32U)
+{
+    ublox::message::NavPvt<> pvt;
+    ublox::message::NavPosllh<> posllh;
+    ublox::message::NavVelned<> velned;
+    ublox::message::NavDop<> dop;
+    ublox::message::NavClock<> clock;
+    ublox::message::NavTimeutc<> timeutc;
+    ublox::message::NavSat<> sat;
+    ublox::message::RxmRawx<> rawx;
+
+    sat.field_data().value().resize(numSvs);
+    sat.doRefresh();
+    rawx.field_data().value().resize(numMeas);
+    rawx.doRefresh();
+
+    std::vector<std::uint8_t> buf;
+    for (auto epoch = 0U; epoch < epochs; ++epoch) {
+        auto iTOW = static_cast<std::uint32_t>(epoch * 1000U);
+        pvt.field_iTOW().value() = iTOW;
+        posllh.field_iTOW().value() = iTOW;
+        velned.field_iTOW().value() = iTOW;
+        dop.field_iTOW().value() = iTOW;
+        clock.field_iTOW().value() = iTOW;
+        timeutc.field_iTOW().value() = iTOW;
+        sat.field_iTOW().value() = iTOW;
+        rawx.field_rcvTow().value() = static_cast<double>(iTOW) / 1000;
+
+        appendMessage(buf, pvt);
+        appendMessage(buf, posllh);
+        appendMessage(buf, velned);
+        appendMessage(buf, dop);
+        appendMessage(buf, clock);
+        appendMessage(buf, timeutc);
+        appendMessage(buf, sat);
+        appendMessage(buf, rawx);
+    }
+    return buf;
+}
+
+/// @brief Number of the frames in single epoch generated by @ref makeCapture().
+const std::size_t FramesPerEpoch = 8U;
+
+/// @brief Location of the message payload in the capture.
+struct Payload
+{
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_len = 0U;
+};
+
+/// @brief Find payload of the first frame with specified ID in the capture.
+inline Payload findPayload(const std::vector<std::uint8_t>& data, ublox::MsgId id)
+{
+    Payload result;
+    ublox::FrameSplitter splitter;
+    splitter.forEach(
+        data.data(), data.size(),
+        [&data, &result, id](const ublox::FrameInfo& info)
+        {
+            if ((info.m_id == id) && (result.m_data == nullptr)) {
+                result.m_data = data.data() + info.m_offset + ublox::protocol::FrameHeaderLength;
+                result.m_len = info.m_payloadLen;
+            }
+        });
+    GASSERT(result.m_data != nullptr);
+    return result;
+}
+
+}  // namespace bench
+
@@ -0,0 +1,900 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Message sets of the @b cc_plugin, defined with the plain
+///     ublox::message types, used by the benchmarks.
+
+#pragma once
+
+#include <tuple>
+
+#include "ublox/Message.h"
+
+#include "ublox/message/NavPosecef.h"
+#include "ublox/message/NavPosecefPoll.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavPosllhPoll.h"
+#include "ublox/message/NavStatus.h"
+#include "ublox/message/NavStatusPoll.h"
+#include "ublox/message/NavDop.h"
+#include "ublox/message/NavDopPoll.h"
+#include "ublox/message/NavAtt.h"
+#include "ublox/message/NavAttPoll.h"
+#include "ublox/message/NavSol.h"
+#include "ublox/message/NavSolPoll.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavPvtPoll.h"
+#include "ublox/message/NavOdo.h"
+#include "ublox/message/NavOdoPoll.h"
+#include "ublox/message/NavResetodo.h"
+#include "ublox/message/NavVelecef.h"
+#include "ublox/message/NavVelecefPoll.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavVelnedPoll.h"
+#include "ublox/message/NavHpposecef.h"
+#include "ublox/message/NavHpposecefPoll.h"
+#include "ublox/message/NavHpposllh.h"
+#include "ublox/message/NavHpposllhPoll.h"
+#include "ublox/message/NavTimegps.h"
+#include "ublox/message/NavTimegpsPoll.h"
+#include "ublox/message/NavTimeutc.h"
+#include "ublox/message/NavTimeutcPoll.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/message/NavClockPoll.h"
+#include "ublox/message/NavTimeglo.h"
+#include "ublox/message/NavTimegloPoll.h"
+#include "ublox/message/NavTimebds.h"
+#include "ublox/message/NavTimebdsPoll.h"
+#include "ublox/message/NavTimegal.h"
+#include "ublox/message/NavTimegalPoll.h"
+#include "ublox/message/NavTimels.h"
+#include "ublox/message/NavTimelsPoll.h"
+#include "ublox/message/NavSvinfo.h"
+#include "ublox/message/NavSvinfoPoll.h"
+#include "ublox/message/NavDgps.h"
+#include "ublox/message/NavDgpsPoll.h"
+#include "ublox/message/NavSbas.h"
+#include "ublox/message/NavSbasPoll.h"
+#include "ublox/message/NavOrb.h"
+#include "ublox/message/NavOrbPoll.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/message/NavSatPoll.h"
+#include "ublox/message/NavGeofence.h"
+#include "ublox/message/NavGeofencePoll.h"
+#include "ublox/message/NavSvin.h"
+#include "ublox/message/NavSvinPoll.h"
+#include "ublox/message/NavRelposned.h"
+#include "ublox/message/NavRelposnedPoll.h"
+#include "ublox/message/NavEkfstatus.h"
+#include "ublox/message/NavEkfstatusPoll.h"
+#include "ublox/message/NavAopstatus.h"
+#include "ublox/message/NavAopstatusU8.h"
+#include "ublox/message/NavAopstatusPoll.h"
+#include "ublox/message/NavEoe.h"
+#include "ublox/message/RxmRaw.h"
+#include "ublox/message/RxmRawPoll.h"
+#include "ublox/message/RxmSfrb.h"
+#include "ublox/message/RxmSfrbx.h"
+#include "ublox/message/RxmMeasx.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/message/RxmRawxPoll.h"
+#include "ublox/message/RxmSvsi.h"
+#include "ublox/message/RxmSvsiPoll.h"
+#include "ublox/message/RxmAlm.h"
+#include "ublox/message/RxmAlmPollSv.h"
+#include "ublox/message/RxmAlmPoll.h"
+#include "ublox/message/RxmEph.h"
+#include "ublox/message/RxmEphPollSv.h"
+#include "ublox/message/RxmEphPoll.h"
+#include "ublox/message/RxmRtcm.h"
+#include "ublox/message/RxmPmreqV0.h"
+#include "ublox/message/RxmPmreq.h"
+#include "ublox/message/RxmRlmShort.h"
+#include "ublox/message/RxmRlmLong.h"
+#include "ublox/message/RxmImes.h"
+#include "ublox/message/RxmImesPoll.h"
+#include "ublox/message/InfError.h"
+#include "ublox/message/InfWarning.h"
+#include "ublox/message/InfNotice.h"
+#include "ublox/message/InfTest.h"
+#include "ublox/message/InfDebug.h"
+#include "ublox/message/AckNak.h"
+#include "ublox/message/AckAck.h"
+#include "ublox/message/CfgPrtUart.h"
+#include "ublox/message/CfgPrtUsb.h"
+#include "ublox/message/CfgPrtSpi.h"
+#include "ublox/message/CfgPrtDdc.h"
+#include "ublox/message/CfgPrtPollPort.h"
+#include "ublox/message/CfgPrtPoll.h"
+#include "ublox/message/CfgMsg.h"
+#include "ublox/message/CfgMsgCurrent.h"
+#include "ublox/message/CfgMsgPoll.h"
+#include "ublox/message/CfgInf.h"
+#include "ublox/message/CfgInfPoll.h"
+#include "ublox/message/CfgRst.h"
+#include "ublox/message/CfgDat.h"
+#include "ublox/message/CfgDatUser.h"
+#include "ublox/message/CfgDatStandard.h"
+#include "ublox/message/CfgDatPoll.h"
+#include "ublox/message/CfgTp.h"
+#include "ublox/message/CfgTpPoll.h"
+#include "ublox/message/CfgRate.h"
+#include "ublox/message/CfgRatePoll.h"
+#include "ublox/message/CfgCfg.h"
+#include "ublox/message/CfgFxn.h"
+#include "ublox/message/CfgFxnPoll.h"
+#include "ublox/message/CfgRxm.h"
+#include "ublox/message/CfgRxmPoll.h"
+#include "ublox/message/CfgEkf.h"
+#include "ublox/message/CfgEkfPoll.h"
+#include "ublox/message/CfgAnt.h"
+#include "ublox/message/CfgAntPoll.h"
+#include "ublox/message/CfgSbas.h"
+#include "ublox/message/CfgSbasPoll.h"
+#include "ublox/message/CfgNmeaExtV1.h"
+#include "ublox/message/CfgNmeaExt.h"
+#include "ublox/message/CfgNmea.h"
+#include "ublox/message/CfgNmeaPoll.h"
+#include "ublox/message/CfgUsb.h"
+#include "ublox/message/CfgUsbPoll.h"
+#include "ublox/message/CfgTmode.h"
+#include "ublox/message/CfgTmodePoll.h"
+#include "ublox/message/CfgOdo.h"
+#include "ublox/message/CfgOdoPoll.h"
+#include "ublox/message/CfgNvs.h"
+#include "ublox/message/CfgNavx5.h"
+#include "ublox/message/CfgNavx5Poll.h"
+#include "ublox/message/CfgNav5.h"
+#include "ublox/message/CfgNav5Poll.h"
+#include "ublox/message/CfgEsfgwt.h"
+#include "ublox/message/CfgEsfgwtPoll.h"
+#include "ublox/message/CfgTp5.h"
+#include "ublox/message/CfgTp5PollSelect.h"
+#include "ublox/message/CfgTp5Poll.h"
+#include "ublox/message/CfgPm.h"
+#include "ublox/message/CfgPmPoll.h"
+#include "ublox/message/CfgRinv.h"
+#include "ublox/message/CfgRinvPoll.h"
+#include "ublox/message/CfgItfm.h"
+#include "ublox/message/CfgItfmPoll.h"
+#include "ublox/message/CfgPm2.h"
+#include "ublox/message/CfgPm2Poll.h"
+#include "ublox/message/CfgTmode2.h"
+#include "ublox/message/CfgTmode2Poll.h"
+#include "ublox/message/CfgGnss.h"
+#include "ublox/message/CfgGnssPoll.h"
+#include "ublox/message/CfgLogfilter.h"
+#include "ublox/message/CfgLogfilterPoll.h"
+#include "ublox/message/CfgTxslot.h"
+#include "ublox/message/CfgPwr.h"
+#include "ublox/message/CfgHnr.h"
+#include "ublox/message/CfgHnrPoll.h"
+#include "ublox/message/CfgEsrc.h"
+#include "ublox/message/CfgEsrcPoll.h"
+#include "ublox/message/CfgDosc.h"
+#include "ublox/message/CfgDoscPoll.h"
+#include "ublox/message/CfgSmgr.h"
+#include "ublox/message/CfgSmgrPoll.h"
+#include "ublox/message/CfgGeofence.h"
+#include "ublox/message/CfgGeofencePoll.h"
+#include "ublox/message/CfgDgnss.h"
+#include "ublox/message/CfgDgnssPoll.h"
+#include "ublox/message/CfgTmode3.h"
+#include "ublox/message/CfgTmode3Poll.h"
+#include "ublox/message/CfgFixseed.h"
+#include "ublox/message/CfgDynseed.h"
+#include "ublox/message/CfgPms.h"
+#include "ublox/message/CfgPmsPoll.h"
+#include "ublox/message/UpdSosRestored.h"
+#include "ublox/message/UpdSosAck.h"
+#include "ublox/message/UpdSosClear.h"
+#include "ublox/message/UpdSosCreate.h"
+#include "ublox/message/UpdSosPoll.h"
+#include "ublox/message/MonIo.h"
+#include "ublox/message/MonIoPoll.h"
+#include "ublox/message/MonVer.h"
+#include "ublox/message/MonVerPoll.h"
+#include "ublox/message/MonMsgpp.h"
+#include "ublox/message/MonMsgppPoll.h"
+#include "ublox/message/MonRxbuf.h"
+#include "ublox/message/MonRxbufPoll.h"
+#include "ublox/message/MonTxbuf.h"
+#include "ublox/message/MonTxbufPoll.h"
+#include "ublox/message/MonHw.h"
+#include "ublox/message/MonHwPoll.h"
+#include "ublox/message/MonHw2.h"
+#include "ublox/message/MonHw2Poll.h"
+#include "ublox/message/MonRxr.h"
+#include "ublox/message/MonPatch.h"
+#include "ublox/message/MonPatchPoll.h"
+#include "ublox/message/MonGnss.h"
+#include "ublox/message/MonGnssPoll.h"
+#include "ublox/message/MonSmgr.h"
+#include "ublox/message/MonSmgrPoll.h"
+#include "ublox/message/AidReq.h"
+#include "ublox/message/AidIni.h"
+#include "ublox/message/AidIniPoll.h"
+#include "ublox/message/AidHui.h"
+#include "ublox/message/AidHuiPoll.h"
+#include "ublox/message/AidData.h"
+#include "ublox/message/AidAlm.h"
+#include "ublox/message/AidAlmPollSv.h"
+#include "ublox/message/AidAlmPoll.h"
+#include "ublox/message/AidEph.h"
+#include "ublox/message/AidEphPollSv.h"
+#include "ublox/message/AidEphPoll.h"
+#include "ublox/message/AidAlpsrv.h"
+#include "ublox/message/AidAlpsrvUpdate.h"
+#include "ublox/message/AidAopU8.h"
+#include "ublox/message/AidAop.h"
+#include "ublox/message/AidAopPollSv.h"
+#include "ublox/message/AidAopPoll.h"
+#include "ublox/message/AidAlp.h"
+#include "ublox/message/AidAlpStatus.h"
+#include "ublox/message/AidAlpData.h"
+#include "ublox/message/TimTp.h"
+#include "ublox/message/TimTpPoll.h"
+#include "ublox/message/TimTm2.h"
+#include "ublox/message/TimTm2Poll.h"
+#include "ublox/message/TimSvin.h"
+#include "ublox/message/TimSvinPoll.h"
+#include "ublox/message/TimVrfy.h"
+#include "ublox/message/TimVrfyPoll.h"
+#include "ublox/message/TimDosc.h"
+#include "ublox/message/TimTos.h"
+#include "ublox/message/TimSmeas.h"
+#include "ublox/message/TimVcocal.h"
+#include "ublox/message/TimVcocalExt.h"
+#include "ublox/message/TimVcocalStop.h"
+#include "ublox/message/TimVcocalPoll.h"
+#include "ublox/message/TimFchg.h"
+#include "ublox/message/TimFchgPoll.h"
+#include "ublox/message/EsfMeas.h"
+#include "ublox/message/EsfMeasPoll.h"
+#include "ublox/message/EsfRaw.h"
+#include "ublox/message/EsfStatus.h"
+#include "ublox/message/EsfStatusPoll.h"
+#include "ublox/message/EsfIns.h"
+#include "ublox/message/EsfInsPoll.h"
+#include "ublox/message/MgaGpsEph.h"
+#include "ublox/message/MgaGpsAlm.h"
+#include "ublox/message/MgaGpsHealth.h"
+#include "ublox/message/MgaGpsUtc.h"
+#include "ublox/message/MgaGpsIono.h"
+#include "ublox/message/MgaGalEph.h"
+#include "ublox/message/MgaGalAlm.h"
+#include "ublox/message/MgaGalTimeoffset.h"
+#include "ublox/message/MgaGalUtc.h"
+#include "ublox/message/MgaBdsEph.h"
+#include "ublox/message/MgaBdsAlm.h"
+#include "ublox/message/MgaBdsHealth.h"
+#include "ublox/message/MgaBdsUtc.h"
+#include "ublox/message/MgaBdsIono.h"
+#include "ublox/message/MgaQzssEph.h"
+#include "ublox/message/MgaQzssAlm.h"
+#include "ublox/message/MgaQzssHealth.h"
+#include "ublox/message/MgaGloEph.h"
+#include "ublox/message/MgaGloAlm.h"
+#include "ublox/message/MgaGloTimeoffset.h"
+#include "ublox/message/MgaAno.h"
+#include "ublox/message/MgaFlashData.h"
+#include "ublox/message/MgaFlashStop.h"
+#include "ublox/message/MgaFlashAck.h"
+#include "ublox/message/MgaIniPosXyz.h"
+#include "ublox/message/MgaIniPosLlh.h"
+#include "ublox/message/MgaIniTimeUtc.h"
+#include "ublox/message/MgaIniTimeGnss.h"
+#include "ublox/message/MgaIniClkd.h"
+#include "ublox/message/MgaIniFreq.h"
+#include "ublox/message/MgaIniEop.h"
+#include "ublox/message/MgaAck.h"
+#include "ublox/message/MgaDbd.h"
+#include "ublox/message/MgaDbdPoll.h"
+#include "ublox/message/LogErase.h"
+#include "ublox/message/LogString.h"
+#include "ublox/message/LogCreate.h"
+#include "ublox/message/LogInfo.h"
+#include "ublox/message/LogInfoPoll.h"
+#include "ublox/message/LogRetrieve.h"
+#include "ublox/message/LogRetrievepos.h"
+#include "ublox/message/LogRetrievestring.h"
+#include "ublox/message/LogFindtimeCmd.h"
+#include "ublox/message/LogFindtime.h"
+#include "ublox/message/LogRetrieveposextra.h"
+#include "ublox/message/SecSign.h"
+#include "ublox/message/SecUniqid.h"
+#include "ublox/message/HnrPvt.h"
+#include "ublox/message/HnrPvtPoll.h"
+
+namespace bench
+{
+
+/// @brief Same message types as ublox::cc_plugin::AllMessages.
+/// @tparam TMessage Common message interface class
+template <typename TMessage = ublox::Message>
+using AllMessages =
+    std::tuple<
+        ublox::message::NavPosecef<TMessage>,
+        ublox::message::NavPosecefPoll<TMessage>,
+        ublox::message::NavPosllh<TMessage>,
+        ublox::message::NavPosllhPoll<TMessage>,
+        ublox::message::NavStatus<TMessage>,
+        ublox::message::NavStatusPoll<TMessage>,
+        ublox::message::NavDop<TMessage>,
+        ublox::message::NavDopPoll<TMessage>,
+        ublox::message::NavAtt<TMessage>,
+        ublox::message::NavAttPoll<TMessage>,
+        ublox::message::NavSol<TMessage>,
+        ublox::message::NavSolPoll<TMessage>,
+        ublox::message::NavPvt<TMessage>,
+        ublox::message::NavPvtPoll<TMessage>,
+        ublox::message::NavOdo<TMessage>,
+        ublox::message::NavOdoPoll<TMessage>,
+        ublox::message::NavResetodo<TMessage>,
+        ublox::message::NavVelecef<TMessage>,
+        ublox::message::NavVelecefPoll<TMessage>,
+        ublox::message::NavVelned<TMessage>,
+        ublox::message::NavVelnedPoll<TMessage>,
+        ublox::message::NavHpposecef<TMessage>,
+        ublox::message::NavHpposecefPoll<TMessage>,
+        ublox::message::NavHpposllh<TMessage>,
+        ublox::message::NavHpposllhPoll<TMessage>,
+        ublox::message::NavTimegps<TMessage>,
+        ublox::message::NavTimegpsPoll<TMessage>,
+        ublox::message::NavTimeutc<TMessage>,
+        ublox::message::NavTimeutcPoll<TMessage>,
+        ublox::message::NavClock<TMessage>,
+        ublox::message::NavClockPoll<TMessage>,
+        ublox::message::NavTimeglo<TMessage>,
+        ublox::message::NavTimegloPoll<TMessage>,
+        ublox::message::NavTimebds<TMessage>,
+        ublox::message::NavTimebdsPoll<TMessage>,
+        ublox::message::NavTimegal<TMessage>,
+        ublox::message::NavTimegalPoll<TMessage>,
+        ublox::message::NavTimels<TMessage>,
+        ublox::message::NavTimelsPoll<TMessage>,
+        ublox::message::NavSvinfo<TMessage>,
+        ublox::message::NavSvinfoPoll<TMessage>,
+        ublox::message::NavDgps<TMessage>,
+        ublox::message::NavDgpsPoll<TMessage>,
+        ublox::message::NavSbas<TMessage>,
+        ublox::message::NavSbasPoll<TMessage>,
+        ublox::message::NavOrb<TMessage>,
+        ublox::message::NavOrbPoll<TMessage>,
+        ublox::message::NavSat<TMessage>,
+        ublox::message::NavSatPoll<TMessage>,
+        ublox::message::NavGeofence<TMessage>,
+        ublox::message::NavGeofencePoll<TMessage>,
+        ublox::message::NavSvin<TMessage>,
+        ublox::message::NavSvinPoll<TMessage>,
+        ublox::message::NavRelposned<TMessage>,
+        ublox::message::NavRelposnedPoll<TMessage>,
+        ublox::message::NavEkfstatus<TMessage>,
+        ublox::message::NavEkfstatusPoll<TMessage>,
+        ublox::message::NavAopstatus<TMessage>,
+        ublox::message::NavAopstatusU8<TMessage>,
+        ublox::message::NavAopstatusPoll<TMessage>,
+        ublox::message::NavEoe<TMessage>,
+        ublox::message::RxmRaw<TMessage>,
+        ublox::message::RxmRawPoll<TMessage>,
+        ublox::message::RxmSfrb<TMessage>,
+        ublox::message::RxmSfrbx<TMessage>,
+        ublox::message::RxmMeasx<TMessage>,
+        ublox::message::RxmRawx<TMessage>,
+        ublox::message::RxmRawxPoll<TMessage>,
+        ublox::message::RxmSvsi<TMessage>,
+        ublox::message::RxmSvsiPoll<TMessage>,
+        ublox::message::RxmAlm<TMessage>,
+        ublox::message::RxmAlmPollSv<TMessage>,
+        ublox::message::RxmAlmPoll<TMessage>,
+        ublox::message::RxmEph<TMessage>,
+        ublox::message::RxmEphPollSv<TMessage>,
+        ublox::message::RxmEphPoll<TMessage>,
+        ublox::message::RxmRtcm<TMessage>,
+        ublox::message::RxmPmreqV0<TMessage>,
+        ublox::message::RxmPmreq<TMessage>,
+        ublox::message::RxmRlmShort<TMessage>,
+        ublox::message::RxmRlmLong<TMessage>,
+        ublox::message::RxmImes<TMessage>,
+        ublox::message::RxmImesPoll<TMessage>,
+        ublox::message::InfError<TMessage>,
+        ublox::message::InfWarning<TMessage>,
+        ublox::message::InfNotice<TMessage>,
+        ublox::message::InfTest<TMessage>,
+        ublox::message::InfDebug<TMessage>,
+        ublox::message::AckNak<TMessage>,
+        ublox::message::AckAck<TMessage>,
+        ublox::message::CfgPrtUart<TMessage>,
+        ublox::message::CfgPrtUsb<TMessage>,
+        ublox::message::CfgPrtSpi<TMessage>,
+        ublox::message::CfgPrtDdc<TMessage>,
+        ublox::message::CfgPrtPollPort<TMessage>,
+        ublox::message::CfgPrtPoll<TMessage>,
+        ublox::message::CfgMsg<TMessage>,
+        ublox::message::CfgMsgCurrent<TMessage>,
+        ublox::message::CfgMsgPoll<TMessage>,
+        ublox::message::CfgInf<TMessage>,
+        ublox::message::CfgInfPoll<TMessage>,
+        ublox::message::CfgRst<TMessage>,
+        ublox::message::CfgDat<TMessage>,
+        ublox::message::CfgDatUser<TMessage>,
+        ublox::message::CfgDatStandard<TMessage>,
+        ublox::message::CfgDatPoll<TMessage>,
+        ublox::message::CfgTp<TMessage>,
+        ublox::message::CfgTpPoll<TMessage>,
+        ublox::message::CfgRate<TMessage>,
+        ublox::message::CfgRatePoll<TMessage>,
+        ublox::message::CfgCfg<TMessage>,
+        ublox::message::CfgFxn<TMessage>,
+        ublox::message::CfgFxnPoll<TMessage>,
+        ublox::message::CfgRxm<TMessage>,
+        ublox::message::CfgRxmPoll<TMessage>,
+        ublox::message::CfgEkf<TMessage>,
+        ublox::message::CfgEkfPoll<TMessage>,
+        ublox::message::CfgAnt<TMessage>,
+        ublox::message::CfgAntPoll<TMessage>,
+        ublox::message::CfgSbas<TMessage>,
+        ublox::message::CfgSbasPoll<TMessage>,
+        ublox::message::CfgNmeaExtV1<TMessage>,
+        ublox::message::CfgNmeaExt<TMessage>,
+        ublox::message::CfgNmea<TMessage>,
+        ublox::message::CfgNmeaPoll<TMessage>,
+        ublox::message::CfgUsb<TMessage>,
+        ublox::message::CfgUsbPoll<TMessage>,
+        ublox::message::CfgTmode<TMessage>,
+        ublox::message::CfgTmodePoll<TMessage>,
+        ublox::message::CfgOdo<TMessage>,
+        ublox::message::CfgOdoPoll<TMessage>,
+        ublox::message::CfgNvs<TMessage>,
+        ublox::message::CfgNavx5<TMessage>,
+        ublox::message::CfgNavx5Poll<TMessage>,
+        ublox::message::CfgNav5<TMessage>,
+        ublox::message::CfgNav5Poll<TMessage>,
+        ublox::message::CfgEsfgwt<TMessage>,
+        ublox::message::CfgEsfgwtPoll<TMessage>,
+        ublox::message::CfgTp5<TMessage>,
+        ublox::message::CfgTp5PollSelect<TMessage>,
+        ublox::message::CfgTp5Poll<TMessage>,
+        ublox::message::CfgPm<TMessage>,
+        ublox::message::CfgPmPoll<TMessage>,
+        ublox::message::CfgRinv<TMessage>,
+        ublox::message::CfgRinvPoll<TMessage>,
+        ublox::message::CfgItfm<TMessage>,
+        ublox::message::CfgItfmPoll<TMessage>,
+        ublox::message::CfgPm2<TMessage>,
+        ublox::message::CfgPm2Poll<TMessage>,
+        ublox::message::CfgTmode2<TMessage>,
+        ublox::message::CfgTmode2Poll<TMessage>,
+        ublox::message::CfgGnss<TMessage>,
+        ublox::message::CfgGnssPoll<TMessage>,
+        ublox::message::CfgLogfilter<TMessage>,
+        ublox::message::CfgLogfilterPoll<TMessage>,
+        ublox::message::CfgTxslot<TMessage>,
+        ublox::message::CfgPwr<TMessage>,
+        ublox::message::CfgHnr<TMessage>,
+        ublox::message::CfgHnrPoll<TMessage>,
+        ublox::message::CfgEsrc<TMessage>,
+        ublox::message::CfgEsrcPoll<TMessage>,
+        ublox::message::CfgDosc<TMessage>,
+        ublox::message::CfgDoscPoll<TMessage>,
+        ublox::message::CfgSmgr<TMessage>,
+        ublox::message::CfgSmgrPoll<TMessage>,
+        ublox::message::CfgGeofence<TMessage>,
+        ublox::message::CfgGeofencePoll<TMessage>,
+        ublox::message::CfgDgnss<TMessage>,
+        ublox::message::CfgDgnssPoll<TMessage>,
+        ublox::message::CfgTmode3<TMessage>,
+        ublox::message::CfgTmode3Poll<TMessage>,
+        ublox::message::CfgFixseed<TMessage>,
+        ublox::message::CfgDynseed<TMessage>,
+        ublox::message::CfgPms<TMessage>,
+        ublox::message::CfgPmsPoll<TMessage>,
+        ublox::message::UpdSosRestored<TMessage>,
+        ublox::message::UpdSosAck<TMessage>,
+        ublox::message::UpdSosClear<TMessage>,
+        ublox::message::UpdSosCreate<TMessage>,
+        ublox::message::UpdSosPoll<TMessage>,
+        ublox::message::MonIo<TMessage>,
+        ublox::message::MonIoPoll<TMessage>,
+        ublox::message::MonVer<TMessage>,
+        ublox::message::MonVerPoll<TMessage>,
+        ublox::message::MonMsgpp<TMessage>,
+        ublox::message::MonMsgppPoll<TMessage>,
+        ublox::message::MonRxbuf<TMessage>,
+        ublox::message::MonRxbufPoll<TMessage>,
+        ublox::message::MonTxbuf<TMessage>,
+        ublox::message::MonTxbufPoll<TMessage>,
+        ublox::message::MonHw<TMessage>,
+        ublox::message::MonHwPoll<TMessage>,
+        ublox::message::MonHw2<TMessage>,
+        ublox::message::MonHw2Poll<TMessage>,
+        ublox::message::MonRxr<TMessage>,
+        ublox::message::MonPatch<TMessage>,
+        ublox::message::MonPatchPoll<TMessage>,
+        ublox::message::MonGnss<TMessage>,
+        ublox::message::MonGnssPoll<TMessage>,
+        ublox::message::MonSmgr<TMessage>,
+        ublox::message::MonSmgrPoll<TMessage>,
+        ublox::message::AidReq<TMessage>,
+        ublox::message::AidIni<TMessage>,
+        ublox::message::AidIniPoll<TMessage>,
+        ublox::message::AidHui<TMessage>,
+        ublox::message::AidHuiPoll<TMessage>,
+        ublox::message::AidData<TMessage>,
+        ublox::message::AidAlm<TMessage>,
+        ublox::message::AidAlmPollSv<TMessage>,
+        ublox::message::AidAlmPoll<TMessage>,
+        ublox::message::AidEph<TMessage>,
+        ublox::message::AidEphPollSv<TMessage>,
+        ublox::message::AidEphPoll<TMessage>,
+        ublox::message::AidAlpsrv<TMessage>,
+        ublox::message::AidAlpsrvUpdate<TMessage>,
+        ublox::message::AidAopU8<TMessage>,
+        ublox::message::AidAop<TMessage>,
+        ublox::message::AidAopPollSv<TMessage>,
+        ublox::message::AidAopPoll<TMessage>,
+        ublox::message::AidAlp<TMessage>,
+        ublox::message::AidAlpStatus<TMessage>,
+        ublox::message::AidAlpData<TMessage>,
+        ublox::message::TimTp<TMessage>,
+        ublox::message::TimTpPoll<TMessage>,
+        ublox::message::TimTm2<TMessage>,
+        ublox::message::TimTm2Poll<TMessage>,
+        ublox::message::TimSvin<TMessage>,
+        ublox::message::TimSvinPoll<TMessage>,
+        ublox::message::TimVrfy<TMessage>,
+        ublox::message::TimVrfyPoll<TMessage>,
+        ublox::message::TimDosc<TMessage>,
+        ublox::message::TimTos<TMessage>,
+        ublox::message::TimSmeas<TMessage>,
+        ublox::message::TimVcocal<TMessage>,
+        ublox::message::TimVcocalExt<TMessage>,
+        ublox::message::TimVcocalStop<TMessage>,
+        ublox::message::TimVcocalPoll<TMessage>,
+        ublox::message::TimFchg<TMessage>,
+        ublox::message::TimFchgPoll<TMessage>,
+        ublox::message::EsfMeas<TMessage>,
+        ublox::message::EsfMeasPoll<TMessage>,
+        ublox::message::EsfRaw<TMessage>,
+        ublox::message::EsfStatus<TMessage>,
+        ublox::message::EsfStatusPoll<TMessage>,
+        ublox::message::EsfIns<TMessage>,
+        ublox::message::EsfInsPoll<TMessage>,
+        ublox::message::MgaGpsEph<TMessage>,
+        ublox::message::MgaGpsAlm<TMessage>,
+        ublox::message::MgaGpsHealth<TMessage>,
+        ublox::message::MgaGpsUtc<TMessage>,
+        ublox::message::MgaGpsIono<TMessage>,
+        ublox::message::MgaGalEph<TMessage>,
+        ublox::message::MgaGalAlm<TMessage>,
+        ublox::message::MgaGalTimeoffset<TMessage>,
+        ublox::message::MgaGalUtc<TMessage>,
+        ublox::message::MgaBdsEph<TMessage>,
+        ublox::message::MgaBdsAlm<TMessage>,
+        ublox::message::MgaBdsHealth<TMessage>,
+        ublox::message::MgaBdsUtc<TMessage>,
+        ublox::message::MgaBdsIono<TMessage>,
+        ublox::message::MgaQzssEph<TMessage>,
+        ublox::message::MgaQzssAlm<TMessage>,
+        ublox::message::MgaQzssHealth<TMessage>,
+        ublox::message::MgaGloEph<TMessage>,
+        ublox::message::MgaGloAlm<TMessage>,
+        ublox::message::MgaGloTimeoffset<TMessage>,
+        ublox::message::MgaAno<TMessage>,
+        ublox::message::MgaFlashData<TMessage>,
+        ublox::message::MgaFlashStop<TMessage>,
+        ublox::message::MgaFlashAck<TMessage>,
+        ublox::message::MgaIniPosXyz<TMessage>,
+        ublox::message::MgaIniPosLlh<TMessage>,
+        ublox::message::MgaIniTimeUtc<TMessage>,
+        ublox::message::MgaIniTimeGnss<TMessage>,
+        ublox::message::MgaIniClkd<TMessage>,
+        ublox::message::MgaIniFreq<TMessage>,
+        ublox::message::MgaIniEop<TMessage>,
+        ublox::message::MgaAck<TMessage>,
+        ublox::message::MgaDbd<TMessage>,
+        ublox::message::MgaDbdPoll<TMessage>,
+        ublox::message::LogErase<TMessage>,
+        ublox::message::LogString<TMessage>,
+        ublox::message::LogCreate<TMessage>,
+        ublox::message::LogInfo<TMessage>,
+        ublox::message::LogInfoPoll<TMessage>,
+        ublox::message::LogRetrieve<TMessage>,
+        ublox::message::LogRetrievepos<TMessage>,
+        ublox::message::LogRetrievestring<TMessage>,
+        ublox::message::LogFindtimeCmd<TMessage>,
+        ublox::message::LogFindtime<TMessage>,
+        ublox::message::LogRetrieveposextra<TMessage>,
+        ublox::message::SecSign<TMessage>,
+        ublox::message::SecUniqid<TMessage>,
+        ublox::message::HnrPvt<TMessage>,
+        ublox::message::HnrPvtPoll<TMessage>
+    >;
+
+/// @brief Same message types as ublox::cc_plugin::Ublox8Messages.
+/// @tparam TMessage Common message interface class
+template <typename TMessage = ublox::Message>
+using Ublox8Messages =
+    std::tuple<
+        ublox::message::NavPosecef<TMessage>,
+        ublox::message::NavPosecefPoll<TMessage>,
+        ublox::message::NavPosllh<TMessage>,
+        ublox::message::NavPosllhPoll<TMessage>,
+        ublox::message::NavStatus<TMessage>,
+        ublox::message::NavStatusPoll<TMessage>,
+        ublox::message::NavDop<TMessage>,
+        ublox::message::NavDopPoll<TMessage>,
+        ublox::message::NavAtt<TMessage>,
+        ublox::message::NavAttPoll<TMessage>,
+        ublox::message::NavSol<TMessage>,
+        ublox::message::NavSolPoll<TMessage>,
+        ublox::message::NavPvt<TMessage>,
+        ublox::message::NavPvtPoll<TMessage>,
+        ublox::message::NavOdo<TMessage>,
+        ublox::message::NavOdoPoll<TMessage>,
+        ublox::message::NavResetodo<TMessage>,
+        ublox::message::NavVelecef<TMessage>,
+        ublox::message::NavVelecefPoll<TMessage>,
+        ublox::message::NavVelned<TMessage>,
+        ublox::message::NavVelnedPoll<TMessage>,
+        ublox::message::NavHpposecef<TMessage>,
+        ublox::message::NavHpposecefPoll<TMessage>,
+        ublox::message::NavHpposllh<TMessage>,
+        ublox::message::NavHpposllhPoll<TMessage>,
+        ublox::message::NavTimegps<TMessage>,
+        ublox::message::NavTimegpsPoll<TMessage>,
+        ublox::message::NavTimeutc<TMessage>,
+        ublox::message::NavTimeutcPoll<TMessage>,
+        ublox::message::NavClock<TMessage>,
+        ublox::message::NavClockPoll<TMessage>,
+        ublox::message::NavTimeglo<TMessage>,
+        ublox::message::NavTimegloPoll<TMessage>,
+        ublox::message::NavTimebds<TMessage>,
+        ublox::message::NavTimebdsPoll<TMessage>,
+        ublox::message::NavTimegal<TMessage>,
+        ublox::message::NavTimegalPoll<TMessage>,
+        ublox::message::NavTimels<TMessage>,
+        ublox::message::NavTimelsPoll<TMessage>,
+        ublox::message::NavSvinfo<TMessage>,
+        ublox::message::NavSvinfoPoll<TMessage>,
+        ublox::message::NavDgps<TMessage>,
+        ublox::message::NavDgpsPoll<TMessage>,
+        ublox::message::NavSbas<TMessage>,
+        ublox::message::NavSbasPoll<TMessage>,
+        ublox::message::NavOrb<TMessage>,
+        ublox::message::NavOrbPoll<TMessage>,
+        ublox::message::NavSat<TMessage>,
+        ublox::message::NavSatPoll<TMessage>,
+        ublox::message::NavGeofence<TMessage>,
+        ublox::message::NavGeofencePoll<TMessage>,
+        ublox::message::NavSvin<TMessage>,
+        ublox::message::NavSvinPoll<TMessage>,
+        ublox::message::NavRelposned<TMessage>,
+        ublox::message::NavRelposnedPoll<TMessage>,
+        ublox::message::NavAopstatusU8<TMessage>,
+        ublox::message::NavAopstatusPoll<TMessage>,
+        ublox::message::NavEoe<TMessage>,
+        ublox::message::RxmSfrbx<TMessage>,
+        ublox::message::RxmMeasx<TMessage>,
+        ublox::message::RxmRawx<TMessage>,
+        ublox::message::RxmRawxPoll<TMessage>,
+        ublox::message::RxmSvsi<TMessage>,
+        ublox::message::RxmSvsiPoll<TMessage>,
+        ublox::message::RxmRtcm<TMessage>,
+        ublox::message::RxmPmreqV0<TMessage>,
+        ublox::message::RxmPmreq<TMessage>,
+        ublox::message::RxmRlmShort<TMessage>,
+        ublox::message::RxmRlmLong<TMessage>,
+        ublox::message::RxmImes<TMessage>,
+        ublox::message::RxmImesPoll<TMessage>,
+        ublox::message::InfError<TMessage>,
+        ublox::message::InfWarning<TMessage>,
+        ublox::message::InfNotice<TMessage>,
+        ublox::message::InfTest<TMessage>,
+        ublox::message::InfDebug<TMessage>,
+        ublox::message::AckNak<TMessage>,
+        ublox::message::AckAck<TMessage>,
+        ublox::message::CfgPrtUart<TMessage>,
+        ublox::message::CfgPrtUsb<TMessage>,
+        ublox::message::CfgPrtSpi<TMessage>,
+        ublox::message::CfgPrtDdc<TMessage>,
+        ublox::message::CfgPrtPollPort<TMessage>,
+        ublox::message::CfgPrtPoll<TMessage>,
+        ublox::message::CfgMsg<TMessage>,
+        ublox::message::CfgMsgCurrent<TMessage>,
+        ublox::message::CfgMsgPoll<TMessage>,
+        ublox::message::CfgInf<TMessage>,
+        ublox::message::CfgInfPoll<TMessage>,
+        ublox::message::CfgRst<TMessage>,
+        ublox::message::CfgDat<TMessage>,
+        ublox::message::CfgDatUser<TMessage>,
+        ublox::message::CfgDatStandard<TMessage>,
+        ublox::message::CfgDatPoll<TMessage>,
+        ublox::message::CfgRate<TMessage>,
+        ublox::message::CfgRatePoll<TMessage>,
+        ublox::message::CfgCfg<TMessage>,
+        ublox::message::CfgRxm<TMessage>,
+        ublox::message::CfgRxmPoll<TMessage>,
+        ublox::message::CfgAnt<TMessage>,
+        ublox::message::CfgAntPoll<TMessage>,
+        ublox::message::CfgSbas<TMessage>,
+        ublox::message::CfgSbasPoll<TMessage>,
+        ublox::message::CfgNmeaExtV1<TMessage>,
+        ublox::message::CfgNmeaExt<TMessage>,
+        ublox::message::CfgNmea<TMessage>,
+        ublox::message::CfgNmeaPoll<TMessage>,
+        ublox::message::CfgUsb<TMessage>,
+        ublox::message::CfgUsbPoll<TMessage>,
+        ublox::message::CfgOdo<TMessage>,
+        ublox::message::CfgOdoPoll<TMessage>,
+        ublox::message::CfgNavx5<TMessage>,
+        ublox::message::CfgNavx5Poll<TMessage>,
+        ublox::message::CfgNav5<TMessage>,
+        ublox::message::CfgNav5Poll<TMessage>,
+        ublox::message::CfgTp5<TMessage>,
+        ublox::message::CfgTp5PollSelect<TMessage>,
+        ublox::message::CfgTp5Poll<TMessage>,
+        ublox::message::CfgRinv<TMessage>,
+        ublox::message::CfgRinvPoll<TMessage>,
+        ublox::message::CfgItfm<TMessage>,
+        ublox::message::CfgItfmPoll<TMessage>,
+        ublox::message::CfgPm2<TMessage>,
+        ublox::message::CfgPm2Poll<TMessage>,
+        ublox::message::CfgTmode2<TMessage>,
+        ublox::message::CfgTmode2Poll<TMessage>,
+        ublox::message::CfgGnss<TMessage>,
+        ublox::message::CfgGnssPoll<TMessage>,
+        ublox::message::CfgLogfilter<TMessage>,
+        ublox::message::CfgLogfilterPoll<TMessage>,
+        ublox::message::CfgTxslot<TMessage>,
+        ublox::message::CfgPwr<TMessage>,
+        ublox::message::CfgHnr<TMessage>,
+        ublox::message::CfgHnrPoll<TMessage>,
+        ublox::message::CfgEsrc<TMessage>,
+        ublox::message::CfgEsrcPoll<TMessage>,
+        ublox::message::CfgDosc<TMessage>,
+        ublox::message::CfgDoscPoll<TMessage>,
+        ublox::message::CfgSmgr<TMessage>,
+        ublox::message::CfgSmgrPoll<TMessage>,
+        ublox::message::CfgGeofence<TMessage>,
+        ublox::message::CfgGeofencePoll<TMessage>,
+        ublox::message::CfgDgnss<TMessage>,
+        ublox::message::CfgDgnssPoll<TMessage>,
+        ublox::message::CfgTmode3<TMessage>,
+        ublox::message::CfgTmode3Poll<TMessage>,
+        ublox::message::CfgFixseed<TMessage>,
+        ublox::message::CfgDynseed<TMessage>,
+        ublox::message::CfgPms<TMessage>,
+        ublox::message::CfgPmsPoll<TMessage>,
+        ublox::message::UpdSosRestored<TMessage>,
+        ublox::message::UpdSosAck<TMessage>,
+        ublox::message::UpdSosClear<TMessage>,
+        ublox::message::UpdSosCreate<TMessage>,
+        ublox::message::UpdSosPoll<TMessage>,
+        ublox::message::MonIo<TMessage>,
+        ublox::message::MonIoPoll<TMessage>,
+        ublox::message::MonVer<TMessage>,
+        ublox::message::MonVerPoll<TMessage>,
+        ublox::message::MonMsgpp<TMessage>,
+        ublox::message::MonMsgppPoll<TMessage>,
+        ublox::message::MonRxbuf<TMessage>,
+        ublox::message::MonRxbufPoll<TMessage>,
+        ublox::message::MonTxbuf<TMessage>,
+        ublox::message::MonTxbufPoll<TMessage>,
+        ublox::message::MonHw<TMessage>,
+        ublox::message::MonHwPoll<TMessage>,
+        ublox::message::MonHw2<TMessage>,
+        ublox::message::MonHw2Poll<TMessage>,
+        ublox::message::MonRxr<TMessage>,
+        ublox::message::MonPatch<TMessage>,
+        ublox::message::MonPatchPoll<TMessage>,
+        ublox::message::MonGnss<TMessage>,
+        ublox::message::MonGnssPoll<TMessage>,
+        ublox::message::MonSmgr<TMessage>,
+        ublox::message::MonSmgrPoll<TMessage>,
+        ublox::message::AidIni<TMessage>,
+        ublox::message::AidIniPoll<TMessage>,
+        ublox::message::AidHui<TMessage>,
+        ublox::message::AidHuiPoll<TMessage>,
+        ublox::message::AidData<TMessage>,
+        ublox::message::AidAlm<TMessage>,
+        ublox::message::AidAlmPollSv<TMessage>,
+        ublox::message::AidAlmPoll<TMessage>,
+        ublox::message::AidEph<TMessage>,
+        ublox::message::AidEphPollSv<TMessage>,
+        ublox::message::AidEphPoll<TMessage>,
+        ublox::message::AidAopU8<TMessage>,
+        ublox::message::AidAopPollSv<TMessage>,
+        ublox::message::AidAopPoll<TMessage>,
+        ublox::message::TimTp<TMessage>,
+        ublox::message::TimTpPoll<TMessage>,
+        ublox::message::TimTm2<TMessage>,
+        ublox::message::TimTm2Poll<TMessage>,
+        ublox::message::TimSvin<TMessage>,
+        ublox::message::TimSvinPoll<TMessage>,
+        ublox::message::TimVrfy<TMessage>,
+        ublox::message::TimVrfyPoll<TMessage>,
+        ublox::message::TimDosc<TMessage>,
+        ublox::message::TimTos<TMessage>,
+        ublox::message::TimSmeas<TMessage>,
+        ublox::message::TimVcocal<TMessage>,
+        ublox::message::TimVcocalExt<TMessage>,
+        ublox::message::TimVcocalStop<TMessage>,
+        ublox::message::TimVcocalPoll<TMessage>,
+        ublox::message::TimFchg<TMessage>,
+        ublox::message::TimFchgPoll<TMessage>,
+        ublox::message::EsfMeas<TMessage>,
+        ublox::message::EsfMeasPoll<TMessage>,
+        ublox::message::EsfRaw<TMessage>,
+        ublox::message::EsfStatus<TMessage>,
+        ublox::message::EsfStatusPoll<TMessage>,
+        ublox::message::EsfIns<TMessage>,
+        ublox::message::EsfInsPoll<TMessage>,
+        ublox::message::MgaGpsEph<TMessage>,
+        ublox::message::MgaGpsAlm<TMessage>,
+        ublox::message::MgaGpsHealth<TMessage>,
+        ublox::message::MgaGpsUtc<TMessage>,
+        ublox::message::MgaGpsIono<TMessage>,
+        ublox::message::MgaGalEph<TMessage>,
+        ublox::message::MgaGalAlm<TMessage>,
+        ublox::message::MgaGalTimeoffset<TMessage>,
+        ublox::message::MgaGalUtc<TMessage>,
+        ublox::message::MgaBdsEph<TMessage>,
+        ublox::message::MgaBdsAlm<TMessage>,
+        ublox::message::MgaBdsHealth<TMessage>,
+        ublox::message::MgaBdsUtc<TMessage>,
+        ublox::message::MgaBdsIono<TMessage>,
+        ublox::message::MgaQzssEph<TMessage>,
+        ublox::message::MgaQzssAlm<TMessage>,
+        ublox::message::MgaQzssHealth<TMessage>,
+        ublox::message::MgaGloEph<TMessage>,
+        ublox::message::MgaGloAlm<TMessage>,
+        ublox::message::MgaGloTimeoffset<TMessage>,
+        ublox::message::MgaAno<TMessage>,
+        ublox::message::MgaFlashData<TMessage>,
+        ublox::message::MgaFlashStop<TMessage>,
+        ublox::message::MgaFlashAck<TMessage>,
+        ublox::message::MgaIniPosXyz<TMessage>,
+        ublox::message::MgaIniPosLlh<TMessage>,
+        ublox::message::MgaIniTimeUtc<TMessage>,
+        ublox::message::MgaIniTimeGnss<TMessage>,
+        ublox::message::MgaIniClkd<TMessage>,
+        ublox::message::MgaIniFreq<TMessage>,
+        ublox::message::MgaIniEop<TMessage>,
+        ublox::message::MgaAck<TMessage>,
+        ublox::message::MgaDbd<TMessage>,
+        ublox::message::MgaDbdPoll<TMessage>,
+        ublox::message::LogErase<TMessage>,
+        ublox::message::LogString<TMessage>,
+        ublox::message::LogCreate<TMessage>,
+        ublox::message::LogInfo<TMessage>,
+        ublox::message::LogInfoPoll<TMessage>,
+        ublox::message::LogRetrieve<TMessage>,
+        ublox::message::LogRetrievepos<TMessage>,
+        ublox::message::LogRetrievestring<TMessage>,
+        ublox::message::LogFindtimeCmd<TMessage>,
+        ublox::message::LogFindtime<TMessage>,
+        ublox::message::LogRetrieveposextra<TMessage>,
+        ublox::message::SecSign<TMessage>,
+        ublox::message::SecUniqid<TMessage>,
+        ublox::message::HnrPvt<TMessage>,
+        ublox::message::HnrPvtPoll<TMessage>
+    >;
+
+}  // namespace bench
@@ -0,0 +1,85 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares implementations of the 8-bit Fletcher checksum
+// (see ublox::protocol::details::fletcher8()) on various buffer lengths.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ublox/protocol/ChecksumCalc.h"
+
+#include "Bench.h"
+
+namespace
+{
+
+using ublox::protocol::details::Fletcher8State;
+using ublox::protocol::details::Fletcher8Func;
+
+void measure(const std::string& name, const std::vector<std::uint8_t>& data, Fletcher8Func func)
+{
+    auto ns =
+        bench::measureNs(
+            [&data, func]()
+            {
+                Fletcher8State state;
+                func(state, data.data(), data.size());
+                bench::doNotOptimize(state);
+            });
+    bench::report(name.c_str(), ns, data.size());
+}
+
+} // namespace
+
+int main()
+{
+    using namespace ublox::protocol::details;
+
+    static const std::size_t Lengths[] = {8U, 36U, 100U, 512U, 2048U, 16384U, 65535U};
+    for (auto len : Lengths) {
+        auto data = bench::randomPayload(len);
+        auto suffix = " (" + std::to_string(len) + " bytes)";
+
+        auto genericNs =
+            bench::measureNs(
+                [&data]()
+                {
+                    auto iter = data.cbegin(); // Byte by byte calculation
+                    auto result = ublox::protocol::ChecksumCalc()(iter, data.size());
+                    bench::doNotOptimize(result);
+                });
+        bench::report(("generic iterator" + suffix).c_str(), genericNs, len);
+
+        measure("fletcher8Bytes" + suffix, data, &fletcher8Bytes);
+        measure("fletcher8Unrolled" + suffix, data, &fletcher8Unrolled);
+#if defined(UBLOX_FLETCHER8_SSE2)
+        measure("fletcher8Sse2" + suffix, data, &fletcher8Sse2);
+#endif
+#if defined(UBLOX_FLETCHER8_X86_DISPATCH)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            measure("fletcher8Avx2" + suffix, data, &fletcher8Avx2);
+        }
+#endif
+        measure("fletcher8" + suffix, data, &fletcher8);
+        std::cout << std::endl;
+    }
+    return 0;
+}
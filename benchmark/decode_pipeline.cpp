@@ -0,0 +1,135 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Measures scaling of ublox::DecodePipeline with the number of worker
+// threads (1 - 16) compared to the single threaded read by the protocol stack.
+// The capture is presented in chunks the way it is received from the device.
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ublox/Stack.h"
+#include "ublox/InputMessages.h"
+#include "ublox/DecodePipeline.h"
+
+#include "Bench.h"
+#include "Capture.h"
+
+namespace
+{
+
+class Handler;
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::Handler<Handler>
+    >;
+
+using AllInMessages = ublox::InputMessages<InMessage>;
+using ProtStack = ublox::Stack<InMessage, AllInMessages>;
+
+class Handler
+{
+public:
+    void handle(InMessage& msg)
+    {
+        bench::doNotOptimize(msg);
+        ++m_count;
+    }
+
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+private:
+    std::size_t m_count = 0U;
+};
+
+const std::size_t ChunkLen = 4096U;
+
+void measureStack(const std::vector<std::uint8_t>& data, std::size_t frames)
+{
+    ProtStack stack;
+    Handler handler;
+    auto ns =
+        bench::measureNs(
+            [&stack, &handler, &data]()
+            {
+                const std::uint8_t* iter = data.data();
+                auto* end = iter + data.size();
+                while (iter < end) {
+                    ProtStack::MsgPtr msgPtr;
+                    auto es = stack.read(msgPtr, iter, static_cast<std::size_t>(end - iter));
+                    if (es != comms::ErrorStatus::Success) {
+                        break;
+                    }
+                    msgPtr->dispatch(handler);
+                }
+            });
+    static_cast<void>(frames);
+    GASSERT((handler.count() % frames) == 0U);
+    bench::report("ublox::Stack (single thread)", ns, data.size(), frames);
+}
+
+void measurePipeline(std::size_t workers, const std::vector<std::uint8_t>& data, std::size_t frames)
+{
+    Handler handler;
+    ublox::DecodePipeline<ProtStack, Handler> pipeline(handler, workers);
+    auto ns =
+        bench::measureNs(
+            [&pipeline, &data]()
+            {
+                std::vector<std::uint8_t> pending;
+                std::size_t offset = 0U;
+                while (offset < data.size()) {
+                    auto len = std::min(ChunkLen, data.size() - offset);
+                    pending.insert(pending.end(), data.begin() + offset, data.begin() + offset + len);
+                    offset += len;
+                    auto consumed = pipeline.process(pending.data(), pending.size());
+                    pending.erase(pending.begin(), pending.begin() + consumed);
+                    pipeline.poll();
+                }
+                pipeline.flush();
+            });
+    static_cast<void>(frames);
+    GASSERT((handler.count() % frames) == 0U);
+    auto name = std::string("ublox::DecodePipeline (") + std::to_string(workers) + " workers)";
+    bench::report(name.c_str(), ns, data.size(), frames);
+}
+
+} // namespace
+
+int main()
+{
+    static const std::size_t Epochs = 1000U;
+    static const std::size_t MaxWorkers = 16U;
+    auto data = bench::makeCapture(Epochs);
+    auto frames = Epochs * bench::FramesPerEpoch;
+
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+    measureStack(data, frames);
+    for (std::size_t workers = 1U; workers <= MaxWorkers; workers *= 2U) {
+        measurePipeline(workers, data, frames);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares the generic read of the fixed length messages with
+// ublox::fastRead(), including the messages allocated from the pool.
+
+#include <cstdio>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/FastRead.h"
+#include "ublox/MessagePool.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/message/NavDop.h"
+#include "ublox/message/NavTimeutc.h"
+
+#include "Bench.h"
+#include "Capture.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+template <typename TMsg>
+void measure(const char* name, ublox::MsgId id, const std::vector<std::uint8_t>& data)
+{
+    static_assert(ublox::FastReadEnabled<TMsg>::value, "Fast read is expected to be enabled");
+    static_assert(ublox::FastReadEnabled<ublox::PooledMessage<TMsg> >::value, "Fast read is expected to be enabled");
+
+    auto payload = bench::findPayload(data, id);
+    TMsg msg;
+    auto genericNs =
+        bench::measureNs(
+            [&msg, &payload]()
+            {
+                const std::uint8_t* iter = payload.m_data;
+                auto es = msg.read(iter, payload.m_len);
+                static_cast<void>(es);
+                GASSERT(es == comms::ErrorStatus::Success);
+                bench::doNotOptimize(msg);
+            });
+
+    auto fastNs =
+        bench::measureNs(
+            [&msg, &payload]()
+            {
+                const std::uint8_t* iter = payload.m_data;
+                auto es = ublox::fastRead(msg, iter, payload.m_len);
+                static_cast<void>(es);
+                GASSERT(es == comms::ErrorStatus::Success);
+                bench::doNotOptimize(msg);
+            });
+
+    std::printf("%s\n", name);
+    bench::report("    read()", genericNs, payload.m_len);
+    bench::report("    ublox::fastRead()", fastNs, payload.m_len);
+}
+
+} // namespace
+
+int main()
+{
+    auto data = bench::makeCapture(1U);
+    measure<ublox::message::NavPosllh<InMessage> >("NAV-POSLLH", ublox::MsgId_NAV_POSLLH, data);
+    measure<ublox::message::NavVelned<InMessage> >("NAV-VELNED", ublox::MsgId_NAV_VELNED, data);
+    measure<ublox::message::NavClock<InMessage> >("NAV-CLOCK", ublox::MsgId_NAV_CLOCK, data);
+    measure<ublox::message::NavDop<InMessage> >("NAV-DOP", ublox::MsgId_NAV_DOP, data);
+    measure<ublox::message::NavTimeutc<InMessage> >("NAV-TIMEUTC", ublox::MsgId_NAV_TIMEUTC, data);
+    return 0;
+}
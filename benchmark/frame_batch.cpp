@@ -0,0 +1,195 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares sending of the configuration burst message by message
+// (protocol stack write, then device write per message) with
+// serialising the whole burst into ublox::FrameBatch and writing it once.
+// The device is emulated by unbuffered writes into the null device.
+
+#include <cstdio>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ublox/Stack.h"
+#include "ublox/FrameBatch.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/CfgPrtUsb.h"
+#include "ublox/message/CfgRate.h"
+#include "ublox/message/CfgMsgCurrent.h"
+
+#include "Bench.h"
+
+namespace
+{
+
+#if defined(_WIN32)
+const char* NullDevice = "NUL";
+#else
+const char* NullDevice = "/dev/null";
+#endif
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using OutBuffer = std::vector<std::uint8_t>;
+using OutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::back_insert_iterator<OutBuffer> >,
+        comms::option::LengthInfoInterface
+    >;
+
+using ProtStack = ublox::Stack<InMessage, std::tuple<ublox::message::NavPosllh<InMessage> > >;
+
+using OutCfgPrtUsb = ublox::message::CfgPrtUsb<OutMessage>;
+using OutCfgRate = ublox::message::CfgRate<OutMessage>;
+using OutCfgMsgCurrent = ublox::message::CfgMsgCurrent<OutMessage>;
+
+const ublox::MsgId EnabledIds[] = {
+    ublox::MsgId_NAV_PVT,
+    ublox::MsgId_NAV_POSLLH,
+    ublox::MsgId_NAV_VELNED,
+    ublox::MsgId_NAV_DOP,
+    ublox::MsgId_NAV_CLOCK,
+    ublox::MsgId_NAV_TIMEUTC,
+    ublox::MsgId_NAV_TIMEGPS,
+    ublox::MsgId_NAV_SAT,
+    ublox::MsgId_NAV_STATUS,
+    ublox::MsgId_NAV_SOL,
+    ublox::MsgId_NAV_EOE,
+    ublox::MsgId_RXM_RAWX,
+    ublox::MsgId_RXM_SFRBX,
+    ublox::MsgId_MON_HW,
+    ublox::MsgId_TIM_TP,
+    ublox::MsgId_NAV_HPPOSLLH,
+};
+
+const std::size_t NumOfEnabledIds = std::extent<decltype(EnabledIds)>::value;
+
+// Number of frames in the burst: CFG-PRT, CFG-RATE and CFG-MSG per enabled ID
+const std::size_t BurstFrames = 2U + NumOfEnabledIds;
+
+template <typename TFunc>
+void forEachMessage(TFunc&& func)
+{
+    static const OutCfgPrtUsb CfgPrt;
+    static const OutCfgRate CfgRate;
+    static const std::vector<OutCfgMsgCurrent> CfgMsgs =
+        []()
+        {
+            std::vector<OutCfgMsgCurrent> msgs(NumOfEnabledIds);
+            for (auto idx = 0U; idx < NumOfEnabledIds; ++idx) {
+                msgs[idx].field_id().value() = EnabledIds[idx];
+                msgs[idx].field_rate().value() = 1U;
+            }
+            return msgs;
+        }();
+
+    func(CfgPrt);
+    func(CfgRate);
+    for (auto& msg : CfgMsgs) {
+        func(msg);
+    }
+}
+
+// Serialises every message with the protocol stack and writes it to the device
+struct PerMessageSender
+{
+    template <typename TMsg>
+    void operator()(const TMsg& msg)
+    {
+        OutBuffer buf;
+        buf.reserve(m_stack.length(msg));
+        auto iter = std::back_inserter(buf);
+        auto es = m_stack.write(msg, iter, buf.max_size());
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            auto* updateIter = &buf[0];
+            es = m_stack.update(updateIter, buf.size());
+        }
+        static_cast<void>(es);
+        GASSERT(es == comms::ErrorStatus::Success);
+        std::fwrite(buf.data(), 1U, buf.size(), m_dev);
+        std::fflush(m_dev);
+        m_bytes += buf.size();
+    }
+
+    ProtStack& m_stack;
+    std::FILE* m_dev;
+    std::size_t m_bytes;
+};
+
+// Serialises every message into the batch
+struct BatchAdder
+{
+    template <typename TMsg>
+    void operator()(const TMsg& msg)
+    {
+        auto es = m_batch.add(msg);
+        static_cast<void>(es);
+        GASSERT(es == comms::ErrorStatus::Success);
+    }
+
+    ublox::FrameBatch& m_batch;
+};
+
+} // namespace
+
+int main()
+{
+    auto* dev = std::fopen(NullDevice, "wb");
+    if (dev == nullptr) {
+        std::fprintf(stderr, "ERROR: Failed to open %s\n", NullDevice);
+        return -1;
+    }
+    std::setvbuf(dev, nullptr, _IONBF, 0U); // Every write reaches the device
+
+    ProtStack stack;
+    std::size_t burstBytes = 0U;
+    auto perMessageNs =
+        bench::measureNs(
+            [&stack, dev, &burstBytes]()
+            {
+                PerMessageSender sender{stack, dev, 0U};
+                forEachMessage(sender);
+                burstBytes = sender.m_bytes;
+            });
+    bench::report("per message write", perMessageNs, burstBytes, BurstFrames);
+
+    ublox::FrameBatch batch;
+    auto batchNs =
+        bench::measureNs(
+            [&batch, dev]()
+            {
+                BatchAdder adder{batch};
+                forEachMessage(adder);
+                batch.flush(
+                    [dev](const std::uint8_t* data, std::size_t len)
+                    {
+                        std::fwrite(data, 1U, len, dev);
+                        std::fflush(dev);
+                    });
+            });
+    bench::report("ublox::FrameBatch", batchNs, burstBytes, BurstFrames);
+
+    std::fclose(dev);
+    return 0;
+}
@@ -0,0 +1,142 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Measures scaling of ublox::ParallelLogReader with the number of worker
+// threads (1 - 32) compared to the single threaded
+// ublox::MappedLog::readMessages(). The synthetic capture is written into
+// a temporary file, which is memory mapped. The chunk length is scaled to
+// the log size and the number of threads, so every worker gets multiple
+// chunks regardless of the thread count.
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ublox/Stack.h"
+#include "ublox/InputMessages.h"
+#include "ublox/MappedLog.h"
+#include "ublox/ParallelLogReader.h"
+
+#include "Bench.h"
+#include "Capture.h"
+
+namespace
+{
+
+class Handler;
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::Handler<Handler>
+    >;
+
+using AllInMessages = ublox::InputMessages<InMessage>;
+using ProtStack = ublox::Stack<InMessage, AllInMessages>;
+
+class Handler
+{
+public:
+    void handle(InMessage& msg)
+    {
+        bench::doNotOptimize(msg);
+        ++m_count;
+    }
+
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+private:
+    std::size_t m_count = 0U;
+};
+
+const char* LogPath = "cc_ublox_parallel_log_bench.ubx";
+
+bool writeLog(const std::vector<std::uint8_t>& data)
+{
+    auto* file = std::fopen(LogPath, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    auto written = std::fwrite(data.data(), 1U, data.size(), file);
+    std::fclose(file);
+    return written == data.size();
+}
+
+int measure(std::size_t frames)
+{
+    static const std::size_t MaxThreads = 32U;
+    static const std::size_t ChunksPerThread = 4U;
+    ublox::MappedLog log(LogPath);
+    if (!log.isOpen()) {
+        std::fprintf(stderr, "ERROR: Failed to map %s\n", LogPath);
+        return -1;
+    }
+
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+    auto serialNs =
+        bench::measureNs(
+            [&log, frames]()
+            {
+                ProtStack stack;
+                Handler handler;
+                log.readMessages(stack, handler);
+                static_cast<void>(frames);
+                GASSERT(handler.count() == frames);
+            });
+    bench::report("ublox::MappedLog::readMessages()", serialNs, log.size(), frames);
+
+    for (std::size_t threads = 1U; threads <= MaxThreads; threads *= 2U) {
+        auto chunkLength = log.size() / (threads * ChunksPerThread);
+        ublox::ParallelLogReader<ProtStack> reader(threads, chunkLength);
+        auto ns =
+            bench::measureNs(
+                [&reader, &log, frames]()
+                {
+                    Handler handler;
+                    reader.readMessages(log, handler);
+                    static_cast<void>(frames);
+                    GASSERT(handler.count() == frames);
+                });
+        auto name =
+            std::string("ublox::ParallelLogReader (") + std::to_string(threads) + " threads, " +
+            std::to_string(reader.chunkLength() / 1024U) + " KB chunks)";
+        bench::report(name.c_str(), ns, log.size(), frames);
+    }
+    return 0;
+}
+
+} // namespace
+
+int main()
+{
+    static const std::size_t Epochs = 20000U;
+    auto data = bench::makeCapture(Epochs);
+    if (!writeLog(data)) {
+        std::fprintf(stderr, "ERROR: Failed to write %s\n", LogPath);
+        return -1;
+    }
+
+    auto result = measure(Epochs * bench::FramesPerEpoch);
+    std::remove(LogPath);
+    return result;
+}
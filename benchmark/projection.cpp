@@ -0,0 +1,106 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares full read of NAV-PVT and RXM-RAWX payloads with selective
+// read of few fields using ublox::Projection.
+
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/Projection.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/RxmRawx.h"
+
+#include "Bench.h"
+#include "Capture.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using InNavPvt = ublox::message::NavPvt<InMessage>;
+using InRxmRawx = ublox::message::RxmRawx<InMessage>;
+using RawxBlock = ublox::message::RxmRawxFields::block;
+
+using PvtProjection =
+    ublox::Projection<
+        ublox::Select<InNavPvt::FieldIdx_iTOW>,
+        ublox::Select<InNavPvt::FieldIdx_fixType>,
+        ublox::Select<InNavPvt::FieldIdx_lon>,
+        ublox::Select<InNavPvt::FieldIdx_lat>,
+        ublox::Select<InNavPvt::FieldIdx_hMSL>
+    >;
+
+using RawxProjection =
+    ublox::Projection<
+        ublox::Select<InRxmRawx::FieldIdx_rcvTow>,
+        ublox::Select<InRxmRawx::FieldIdx_data, RawxBlock::FieldIdx_prMes, RawxBlock::FieldIdx_gnssId, RawxBlock::FieldIdx_svId, RawxBlock::FieldIdx_cno>
+    >;
+
+template <typename TMsg>
+void measureFull(const char* name, const bench::Payload& payload)
+{
+    TMsg msg;
+    auto ns =
+        bench::measureNs(
+            [&msg, &payload]()
+            {
+                const std::uint8_t* iter = payload.m_data;
+                auto es = msg.read(iter, payload.m_len);
+                static_cast<void>(es);
+                GASSERT(es == comms::ErrorStatus::Success);
+                bench::doNotOptimize(msg);
+            });
+    bench::report(name, ns, payload.m_len);
+}
+
+template <typename TProjection, typename TMsg>
+void measureProjection(const char* name, const bench::Payload& payload)
+{
+    TMsg msg;
+    auto ns =
+        bench::measureNs(
+            [&msg, &payload]()
+            {
+                const std::uint8_t* iter = payload.m_data;
+                auto es = TProjection::read(msg, iter, payload.m_len);
+                static_cast<void>(es);
+                GASSERT(es == comms::ErrorStatus::Success);
+                bench::doNotOptimize(msg);
+            });
+    bench::report(name, ns, payload.m_len);
+}
+
+} // namespace
+
+int main()
+{
+    auto data = bench::makeCapture(1U);
+    auto pvt = bench::findPayload(data, ublox::MsgId_NAV_PVT);
+    auto rawx = bench::findPayload(data, ublox::MsgId_RXM_RAWX);
+
+    measureFull<InNavPvt>("NAV-PVT full read", pvt);
+    measureProjection<PvtProjection, InNavPvt>("NAV-PVT projection (5 fields)", pvt);
+    measureFull<InRxmRawx>("RXM-RAWX full read (32 meas)", rawx);
+    measureProjection<RawxProjection, InRxmRawx>("RXM-RAWX projection (4 members)", rawx);
+    return 0;
+}
@@ -0,0 +1,139 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares dispatching of the decoded messages to the handler using
+// virtual dispatch() of the message interface with ublox::dispatchStatic()
+// using the ID reported by the frame splitter.
+
+#include <utility>
+#include <vector>
+
+#include "ublox/Stack.h"
+#include "ublox/InputMessages.h"
+#include "ublox/FrameSplitter.h"
+#include "ublox/StaticDispatch.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/RxmRawx.h"
+
+#include "Bench.h"
+#include "Capture.h"
+
+namespace
+{
+
+class Handler;
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::Handler<Handler>
+    >;
+
+using AllInMessages = ublox::InputMessages<InMessage>;
+using ProtStack = ublox::Stack<InMessage, AllInMessages>;
+
+using InNavPvt = ublox::message::NavPvt<InMessage>;
+using InRxmRawx = ublox::message::RxmRawx<InMessage>;
+
+class Handler
+{
+public:
+    void handle(InNavPvt& msg)
+    {
+        m_sum += msg.field_iTOW().value();
+    }
+
+    void handle(InRxmRawx& msg)
+    {
+        m_sum += msg.field_data().value().size();
+    }
+
+    void handle(InMessage&)
+    {
+        ++m_sum;
+    }
+
+    std::uint64_t sum() const
+    {
+        return m_sum;
+    }
+
+private:
+    std::uint64_t m_sum = 0U;
+};
+
+struct Decoded
+{
+    ublox::MsgId m_id;
+    ProtStack::MsgPtr m_msg;
+};
+
+std::vector<Decoded> decode(const std::vector<std::uint8_t>& data)
+{
+    std::vector<Decoded> result;
+    ProtStack stack;
+    ublox::FrameSplitter splitter;
+    splitter.forEach(
+        data.data(), data.size(),
+        [&data, &stack, &result](const ublox::FrameInfo& info)
+        {
+            Decoded decoded;
+            decoded.m_id = info.m_id;
+            const std::uint8_t* iter = data.data() + info.m_offset;
+            auto es = stack.read(decoded.m_msg, iter, info.length());
+            if (es == comms::ErrorStatus::Success) {
+                result.push_back(std::move(decoded));
+            }
+        });
+    return result;
+}
+
+} // namespace
+
+int main()
+{
+    static const std::size_t Epochs = 100U;
+    auto data = bench::makeCapture(Epochs);
+    auto msgs = decode(data);
+    GASSERT(msgs.size() == (Epochs * bench::FramesPerEpoch));
+
+    Handler virtHandler;
+    auto virtNs =
+        bench::measureNs(
+            [&msgs, &virtHandler]()
+            {
+                for (auto& decoded : msgs) {
+                    decoded.m_msg->dispatch(virtHandler);
+                }
+            });
+    bench::doNotOptimize(virtHandler);
+    bench::report("virtual dispatch()", virtNs, 0U, msgs.size());
+
+    Handler staticHandler;
+    auto staticNs =
+        bench::measureNs(
+            [&msgs, &staticHandler]()
+            {
+                for (auto& decoded : msgs) {
+                    ublox::dispatchStatic<AllInMessages>(decoded.m_id, *decoded.m_msg, staticHandler);
+                }
+            });
+    bench::doNotOptimize(staticHandler);
+    bench::report("ublox::dispatchStatic()", staticNs, 0U, msgs.size());
+    return 0;
+}
@@ -0,0 +1,130 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Compares the default protocol stack (ublox::Stack) with ublox::TableStack
+// for the input messages (ublox::InputMessages) as well as for the full
+// message sets of the cc_plugin (all messages and u-blox 8 ones).
+// The lookup of the message type with creation of the message object
+// (createMsg()) is measured separately from the full read, because
+// ublox::TableStack also reads the payload with ublox::fastRead().
+
+#include <string>
+#include <vector>
+
+#include "ublox/Stack.h"
+#include "ublox/TableStack.h"
+#include "ublox/InputMessages.h"
+#include "ublox/protocol/Frame.h"
+
+#include "Bench.h"
+#include "Capture.h"
+#include "PluginMessages.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using IdsList = std::vector<ublox::MsgId>;
+
+IdsList frameIds(const std::vector<std::uint8_t>& data)
+{
+    IdsList ids;
+    const std::uint8_t* iter = data.data();
+    auto* end = iter + data.size();
+    while (iter < end) {
+        ids.push_back(ublox::protocol::frameMsgId(iter));
+        iter += ublox::protocol::frameLength(iter);
+    }
+    return ids;
+}
+
+template <typename TStack>
+void measureCreate(const std::string& name, const IdsList& ids, std::size_t bytes)
+{
+    TStack stack;
+    auto ns =
+        bench::measureNs(
+            [&stack, &ids]()
+            {
+                for (auto id : ids) {
+                    auto msgPtr = stack.createMsg(id);
+                    GASSERT(msgPtr);
+                    bench::doNotOptimize(msgPtr);
+                }
+            });
+    bench::report(name.c_str(), ns, bytes, ids.size());
+}
+
+template <typename TStack>
+void measureRead(const std::string& name, const std::vector<std::uint8_t>& data, std::size_t frames)
+{
+    TStack stack;
+    auto ns =
+        bench::measureNs(
+            [&stack, &data, frames]()
+            {
+                const std::uint8_t* iter = data.data();
+                auto* end = iter + data.size();
+                std::size_t count = 0U;
+                while (iter < end) {
+                    typename TStack::MsgPtr msgPtr;
+                    auto es = stack.read(msgPtr, iter, static_cast<std::size_t>(end - iter));
+                    if (es != comms::ErrorStatus::Success) {
+                        break;
+                    }
+                    bench::doNotOptimize(msgPtr);
+                    ++count;
+                }
+
+                static_cast<void>(frames);
+                static_cast<void>(count);
+                GASSERT(count == frames);
+            });
+    bench::report(name.c_str(), ns, data.size(), frames);
+}
+
+template <typename TMessages>
+void measureSet(const std::string& setName, const std::vector<std::uint8_t>& data, const IdsList& ids)
+{
+    using DefaultStack = ublox::Stack<InMessage, TMessages>;
+    using TableStack = ublox::TableStack<InMessage, TMessages>;
+
+    measureCreate<DefaultStack>(setName + ": ublox::Stack create", ids, data.size());
+    measureCreate<TableStack>(setName + ": ublox::TableStack create", ids, data.size());
+    measureRead<DefaultStack>(setName + ": ublox::Stack read", data, ids.size());
+    measureRead<TableStack>(setName + ": ublox::TableStack read (fast read)", data, ids.size());
+}
+
+} // namespace
+
+int main()
+{
+    static const std::size_t Epochs = 1000U;
+    auto data = bench::makeCapture(Epochs);
+    auto ids = frameIds(data);
+    GASSERT(ids.size() == (Epochs * bench::FramesPerEpoch));
+
+    measureSet<ublox::InputMessages<InMessage> >("input messages", data, ids);
+    measureSet<bench::AllMessages<InMessage> >("cc_plugin all messages", data, ids);
+    measureSet<bench::Ublox8Messages<InMessage> >("cc_plugin u-blox 8 messages", data, ids);
+    return 0;
+}
@@ -0,0 +1,312 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#include "ublox/MsgInfo.h"
+#include "ublox/MappedLog.h"
+#include "ublox/NavTime.h"
+
+namespace
+{
+
+const std::size_t NumOfIds = std::numeric_limits<std::uint16_t>::max() + 1U;
+const std::size_t OutBufSize = 8U * 1024U * 1024U;
+
+using IdsFilter = std::vector<bool>;
+
+// Boundary of the time window
+struct TimeBound
+{
+    bool m_hasWeek = false;
+    std::uint16_t m_week = 0U;
+    std::uint32_t m_iTOW = 0U;
+};
+
+void printUsage(const char* app)
+{
+    std::cerr <<
+        "Usage: " << app << " [options] <in.ubx> <out.ubx>\n"
+        "Copies the valid frames matching the filter without decoding them.\n"
+        "Options:\n"
+        "  -i <spec>   Include messages (repeatable), all if not specified\n"
+        "  -x <spec>   Exclude messages (repeatable)\n"
+        "  -f <time>   Copy frames of the epochs starting at this GPS time\n"
+        "  -t <time>   Copy frames of the epochs before this GPS time\n"
+        "The <spec> is message class or ID, either numeric (\"0x0a\", \"0x0107\")\n"
+        "or by name (\"MON\", \"NAV-PVT\").\n"
+        "The <time> is \"[<week>:]<iTOW>\", the time of week is in ms. Without\n"
+        "the week it refers to the week of the first epoch in the log, and the\n"
+        "end before the start refers to the following week." << std::endl;
+}
+
+// Parses unsigned decimal number, returns false on any other input
+bool parseNumber(const std::string& str, std::uint64_t maxValue, std::uint64_t& value)
+{
+    if (str.empty() || (str.find_first_not_of("0123456789") != std::string::npos)) {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    auto num = std::strtoull(str.c_str(), &end, 10);
+    if ((errno != 0) || (*end != '\0') || (maxValue < num)) {
+        return false;
+    }
+
+    value = num;
+    return true;
+}
+
+// Parses "[<week>:]<iTOW>" time specification
+bool parseTime(const std::string& spec, TimeBound& bound)
+{
+    auto towStr = spec;
+    auto sep = spec.find(':');
+    std::uint64_t value = 0U;
+    if (sep != std::string::npos) {
+        if (!parseNumber(spec.substr(0, sep), ublox::NavTimeTracker::UnknownWeek - 1U, value)) {
+            return false;
+        }
+
+        bound.m_hasWeek = true;
+        bound.m_week = static_cast<std::uint16_t>(value);
+        towStr = spec.substr(sep + 1U);
+    }
+
+    if (!parseNumber(towStr, ublox::NavMsPerWeek - 1U, value)) {
+        return false;
+    }
+
+    bound.m_iTOW = static_cast<std::uint32_t>(value);
+    return true;
+}
+
+// Marks all the IDs matching the spec, returns false on unknown spec
+bool markIds(const std::string& spec, IdsFilter& ids, bool value)
+{
+    char* end = nullptr;
+    auto num = std::strtoul(spec.c_str(), &end, 0);
+    if ((!spec.empty()) && (*end == '\0')) {
+        if (std::numeric_limits<std::uint8_t>::max() < num) {
+            if (std::numeric_limits<std::uint16_t>::max() < num) {
+                return false;
+            }
+
+            ids[num] = value;
+            return true;
+        }
+
+        for (auto idx = 0U; idx <= std::numeric_limits<std::uint8_t>::max(); ++idx) {
+            ids[(num << 8U) | idx] = value;
+        }
+        return true;
+    }
+
+    auto id = ublox::MsgId();
+    if (ublox::msgIdByName(spec.c_str(), id)) {
+        ids[static_cast<std::uint16_t>(id)] = value;
+        return true;
+    }
+
+    std::uint8_t classId = 0U;
+    if (!ublox::msgClassByName(spec.c_str(), classId)) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx <= std::numeric_limits<std::uint8_t>::max(); ++idx) {
+        ids[(static_cast<unsigned>(classId) << 8U) | idx] = value;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> includes;
+    std::vector<std::string> excludes;
+    TimeBound fromBound;
+    TimeBound toBound;
+    bool hasFrom = false;
+    bool hasTo = false;
+    std::vector<std::string> files;
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((arg.size() != 2U) || (arg[0] != '-')) {
+            files.push_back(arg);
+            continue;
+        }
+
+        if ((argc - 1) <= idx) {
+            printUsage(argv[0]);
+            return -1;
+        }
+
+        ++idx;
+        switch (arg[1]) {
+            case 'i':
+                includes.push_back(argv[idx]);
+                break;
+            case 'x':
+                excludes.push_back(argv[idx]);
+                break;
+            case 'f':
+                if (!parseTime(argv[idx], fromBound)) {
+                    std::cerr << "ERROR: Invalid time " << argv[idx] << std::endl;
+                    return -1;
+                }
+                hasFrom = true;
+                break;
+            case 't':
+                if (!parseTime(argv[idx], toBound)) {
+                    std::cerr << "ERROR: Invalid time " << argv[idx] << std::endl;
+                    return -1;
+                }
+                hasTo = true;
+                break;
+            default:
+                printUsage(argv[0]);
+                return -1;
+        }
+    }
+
+    if (files.size() != 2U) {
+        printUsage(argv[0]);
+        return -1;
+    }
+
+    IdsFilter ids(NumOfIds, includes.empty());
+    for (auto& spec : includes) {
+        if (!markIds(spec, ids, true)) {
+            std::cerr << "ERROR: Unknown message " << spec << std::endl;
+            return -1;
+        }
+    }
+
+    for (auto& spec : excludes) {
+        if (!markIds(spec, ids, false)) {
+            std::cerr << "ERROR: Unknown message " << spec << std::endl;
+            return -1;
+        }
+    }
+
+    ublox::MappedLog log(files[0]);
+    if (!log.isOpen()) {
+        std::cerr << "ERROR: Failed to open " << files[0] << std::endl;
+        return -1;
+    }
+
+    auto* out = std::fopen(files[1].c_str(), "wb");
+    if (out == nullptr) {
+        std::cerr << "ERROR: Failed to create " << files[1] << std::endl;
+        return -1;
+    }
+
+    std::vector<char> outBuf(OutBufSize);
+    std::setvbuf(out, outBuf.data(), _IOFBF, outBuf.size());
+
+    // Adjacent copied frames are written with single call
+    std::size_t runBegin = 0U;
+    std::size_t runEnd = 0U;
+    std::uint64_t frames = 0U;
+    std::uint64_t copied = 0U;
+    std::uint64_t written = 0U;
+    bool writeOk = true;
+    auto flushRun =
+        [&]()
+        {
+            if (runBegin < runEnd) {
+                auto len = runEnd - runBegin;
+                writeOk = writeOk && (std::fwrite(log.data() + runBegin, 1U, len, out) == len);
+                written += len;
+            }
+        };
+
+    // The window is resolved to GPS time (ms since week 0) when the time
+    // of the first epoch is known, and once again when its week becomes known
+    bool hasWindow = hasFrom || hasTo;
+    bool windowResolved = false;
+    auto windowWeek = ublox::NavTimeTracker::UnknownWeek;
+    auto fromMs = std::numeric_limits<std::uint64_t>::min();
+    auto toMs = std::numeric_limits<std::uint64_t>::max();
+    auto resolveWindow =
+        [&](std::uint16_t firstWeek)
+        {
+            auto boundMs =
+                [firstWeek](const TimeBound& bound)
+                {
+                    auto week = bound.m_hasWeek ? bound.m_week : firstWeek;
+                    return ublox::NavTimeTracker::timeMs(week, bound.m_iTOW);
+                };
+
+            if (hasFrom) {
+                fromMs = boundMs(fromBound);
+            }
+
+            if (hasTo) {
+                toMs = boundMs(toBound);
+                if ((!toBound.m_hasWeek) && (toMs <= fromMs)) {
+                    toMs += ublox::NavMsPerWeek;
+                }
+            }
+            windowResolved = true;
+            windowWeek = firstWeek;
+        };
+
+    ublox::NavTimeTracker navTime;
+    for (auto& info : log) {
+        ++frames;
+        auto id = static_cast<std::uint16_t>(info.m_id);
+        if (hasWindow &&
+            navTime.update(info.m_id, log.payload(info), info.m_payloadLen) &&
+            ((!windowResolved) || (windowWeek == ublox::NavTimeTracker::UnknownWeek))) {
+            resolveWindow(navTime.week());
+        }
+
+        if ((!ids[id]) ||
+            (hasWindow && ((navTime.iTOW() == ublox::NavTimeTracker::UnknownTow) ||
+                           (navTime.timeMs() < fromMs) || (toMs <= navTime.timeMs())))) {
+            continue;
+        }
+
+        ++copied;
+        if (info.m_offset != runEnd) {
+            flushRun();
+            runBegin = info.m_offset;
+        }
+        runEnd = info.m_offset + info.length();
+    }
+
+    flushRun();
+    writeOk = (std::fclose(out) == 0) && writeOk;
+    if (!writeOk) {
+        std::cerr << "ERROR: Failed to write " << files[1] << std::endl;
+        return -1;
+    }
+
+    std::cout << copied << " of " << frames << " frames copied (" <<
+        written << " of " << log.size() << " bytes)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,81 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+#include "ublox/MappedLog.h"
+#include "ublox/LogIndex.h"
+
+namespace
+{
+
+void printUsage(const char* app)
+{
+    std::cerr <<
+        "Usage: " << app << " <log.ubx> [<week> <iTOW>]\n"
+        "Creates or updates the index of the log (stored in <log.ubx>.idx)\n"
+        "and optionally prints offset of the first frame at or after specified\n"
+        "GPS week and time of week (in milliseconds)." << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if ((argc != 2) && (argc != 4)) {
+        printUsage(argv[0]);
+        return -1;
+    }
+
+    std::string logPath(argv[1]);
+    ublox::MappedLog log(logPath);
+    if (!log.isOpen()) {
+        std::cerr << "ERROR: Failed to open " << logPath << std::endl;
+        return -1;
+    }
+
+    auto idxPath = ublox::LogIndex::sidecarPath(logPath);
+    ublox::LogIndex index;
+    index.load(idxPath); // Rebuilt from scratch if doesn't exist
+
+    auto added = index.update(log.data(), log.size());
+    if ((0U < added) && (!index.save(idxPath))) {
+        std::cerr << "ERROR: Failed to save " << idxPath << std::endl;
+        return -1;
+    }
+
+    std::cout << index.size() << " frames indexed (" << added << " new)" << std::endl;
+    if (argc != 4) {
+        return 0;
+    }
+
+    auto week = static_cast<std::uint16_t>(std::strtoul(argv[2], nullptr, 0));
+    auto iTOW = static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 0));
+    auto entryIdx = index.findTime(week, iTOW);
+    if (index.size() <= entryIdx) {
+        std::cout << "No frames at or after specified time" << std::endl;
+        return 0;
+    }
+
+    auto& entry = index.entries()[entryIdx];
+    std::cout << "Offset: " << entry.m_offset << ", ID: 0x" << std::hex <<
+        static_cast<unsigned>(entry.m_id) << std::dec << std::endl;
+    return 0;
+}
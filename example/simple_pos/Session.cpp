@@ -30,7 +30,8 @@ CC_ENABLE_WARNINGS()
 #include "ublox/message/NavPosllhPoll.h"
 
 Session::Session(const QString &dev)
-  : m_serial(dev)
+  : m_serial(dev),
+    m_reader(*this)
 {
     connect(
         &m_serial, SIGNAL(error(QSerialPort::SerialPortError)),
@@ -60,8 +61,10 @@ bool Session::start()
     m_serial.setStopBits(QSerialPort::OneStop);
     m_serial.setFlowControl(QSerialPort::NoFlowControl);
 
+    // The configuration and the first poll are sent with a single write
     configureUbxOutput();
-    sendPosPoll();
+    addPosPoll();
+    flushMessages();
     m_pollTimer.setSingleShot(false);
     m_pollTimer.setInterval(1000); // poll every second
     m_pollTimer.start();
@@ -83,40 +86,17 @@ void Session::handle(InMessage& msg)
 void Session::performRead()
 {
     auto data = m_serial.readAll();
-    auto dataBegIter = data.constData();
-    auto dataEndIter = dataBegIter + data.size();
-    m_inData.insert(m_inData.end(), dataBegIter, dataEndIter);
-
-    std::size_t consumed = 0U;
-    while (consumed < m_inData.size()) {
-        // Smart pointer to the message object.
-        ProtStack::MsgPtr msgPtr;
-        // Type of the message interface class
-        using MsgType = ProtStack::MsgPtr::element_type;
-
-        // Get the iterator for reading
-        auto begIter = comms::readIteratorFor<MsgType>(&m_inData[0] + consumed);
-        auto iter = begIter;
-        // Do the read
-        auto es = m_stack.read(msgPtr, iter, m_inData.size() - consumed);
-        if (es == comms::ErrorStatus::NotEnoughData) {
-            break; // Not enough data in the buffer, stop processing
-        }
-
-        if (es == comms::ErrorStatus::ProtocolError) {
-            // Something is not right with the data, remove one character and try again
-           ++consumed;
-            continue;
-        }
-        if (es == comms::ErrorStatus::Success) {
-            assert(msgPtr); // If read is successful, msgPtr is expected to hold a valid pointer
-            msgPtr->dispatch(*this); // Dispatch message for handling
-        }
-        // The iterator for reading has been advanced, update the difference
-        consumed += std::distance(begIter, iter);
+    auto* dataIter = reinterpret_cast<const std::uint8_t*>(data.constData());
+    auto remLen = static_cast<std::size_t>(data.size());
+    while (0U < remLen) {
+        // Copy as much as fits into the reader's buffer
+        auto accepted = m_reader.feed(dataIter, remLen);
+        dataIter += accepted;
+        remLen -= accepted;
+
+        // Read and dispatch all the complete messages
+        m_reader.poll();
     }
-
-    m_inData.erase(m_inData.begin(), m_inData.begin() + consumed);
 }
 
 void Session::errorOccurred(QSerialPort::SerialPortError err)
@@ -133,24 +113,26 @@ void Session::errorOccurred(QSerialPort::SerialPortError err)
 
 void Session::sendPosPoll()
 {
-    using OutNavPosllhPoll = ublox::message::NavPosllhPoll<OutMessage>;
-    sendMessage(OutNavPosllhPoll());
+    addPosPoll();
+    flushMessages();
 }
 
-void Session::sendMessage(const OutMessage& msg)
+template <typename TMsg>
+void Session::addMessage(const TMsg& msg)
 {
-    OutBuffer buf;
-    buf.reserve(m_stack.length(msg)); // Reserve enough space
-    auto iter = std::back_inserter(buf);
-    auto es = m_stack.write(msg, iter, buf.max_size());
-    if (es == comms::ErrorStatus::UpdateRequired) {
-        auto* updateIter = &buf[0];
-        es = m_stack.update(updateIter, buf.size());
-    }
+    auto es = m_outBatch.add(msg); // the arena is reused, no allocation
     static_cast<void>(es);
     assert(es == comms::ErrorStatus::Success); // do not expect any error
-    m_serial.write(reinterpret_cast<const char*>(&buf[0]), buf.size());
-    m_serial.flush();
+}
+
+void Session::flushMessages()
+{
+    m_outBatch.flush(
+        [this](const std::uint8_t* data, std::size_t len)
+        {
+            m_serial.write(reinterpret_cast<const char*>(data), static_cast<qint64>(len));
+            m_serial.flush();
+        });
 }
 
 void Session::configureUbxOutput()
@@ -169,5 +151,11 @@ void Session::configureUbxOutput()
     inProtoMaskField.setBitValue(InProtoMaskField::BitIdx_inUbx, true);
     inProtoMaskField.setBitValue(InProtoMaskField::BitIdx_inNmea, false);
 
-    sendMessage(msg);
+    addMessage(msg);
+}
+
+void Session::addPosPoll()
+{
+    using OutNavPosllhPoll = ublox::message::NavPosllhPoll<OutMessage>;
+    addMessage(OutNavPosllhPoll());
 }
@@ -30,6 +30,8 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "ublox/ublox.h"
+#include "ublox/StreamReader.h"
+#include "ublox/FrameBatch.h"
 #include "ublox/message/NavPosllh.h"
 
 class Session : public QObject
@@ -77,11 +79,14 @@ private:
 
     using ProtStack = ublox::Stack<InMessage, AllInMessages>;
 
-    void sendMessage(const OutMessage& msg);
+    template <typename TMsg>
+    void addMessage(const TMsg& msg);
+    void flushMessages();
     void configureUbxOutput();
+    void addPosPoll();
 
     QSerialPort m_serial;
     QTimer m_pollTimer;
-    std::vector<std::uint8_t> m_inData;
-    ProtStack m_stack;
+    ublox::StreamReader<ProtStack, Session> m_reader;
+    ublox::FrameBatch m_outBatch;
 };
@@ -0,0 +1,449 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::AnyInputMessage class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "MsgIdTable.h"
+#include "FastRead.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TMessages>
+struct AnyMsgTraits;
+
+template <>
+struct AnyMsgTraits<std::tuple<> >
+{
+    static const std::size_t Size = 1U;
+    static const std::size_t Align = 1U;
+};
+
+template <typename TMsg, typename... TRest>
+struct AnyMsgTraits<std::tuple<TMsg, TRest...> >
+{
+    using RestTraits = AnyMsgTraits<std::tuple<TRest...> >;
+    static const std::size_t Size =
+        (RestTraits::Size < sizeof(TMsg)) ? sizeof(TMsg) : RestTraits::Size;
+    static const std::size_t Align =
+        (RestTraits::Align < alignof(TMsg)) ? alignof(TMsg) : RestTraits::Align;
+};
+
+template <typename TMessages>
+struct AnyMsgOps;
+
+template <typename... TMessages>
+struct AnyMsgOps<std::tuple<TMessages...> >
+{
+    using ConstructFunc = void (*)(void*);
+    using CopyFunc = void (*)(void*, const void*);
+    using MoveFunc = void (*)(void*, void*);
+    using DestroyFunc = void (*)(void*);
+
+    template <typename TMsg>
+    static void construct(void* to)
+    {
+        new (to) TMsg;
+    }
+
+    template <typename TMsg>
+    static void copy(void* to, const void* from)
+    {
+        new (to) TMsg(*static_cast<const TMsg*>(from));
+    }
+
+    template <typename TMsg>
+    static void move(void* to, void* from)
+    {
+        new (to) TMsg(std::move(*static_cast<TMsg*>(from)));
+    }
+
+    template <typename TMsg>
+    static void destroy(void* obj)
+    {
+        static_cast<TMsg*>(obj)->~TMsg();
+    }
+
+    // Extra element avoids zero sized arrays for empty tuple
+    static void construct(std::size_t idx, void* to)
+    {
+        static const ConstructFunc Funcs[sizeof...(TMessages) + 1] = {&construct<TMessages>..., nullptr};
+        Funcs[idx](to);
+    }
+
+    static void copy(std::size_t idx, void* to, const void* from)
+    {
+        static const CopyFunc Funcs[sizeof...(TMessages) + 1] = {&copy<TMessages>..., nullptr};
+        Funcs[idx](to, from);
+    }
+
+    static void move(std::size_t idx, void* to, void* from)
+    {
+        static const MoveFunc Funcs[sizeof...(TMessages) + 1] = {&move<TMessages>..., nullptr};
+        Funcs[idx](to, from);
+    }
+
+    static void destroy(std::size_t idx, void* obj)
+    {
+        static const DestroyFunc Funcs[sizeof...(TMessages) + 1] = {&destroy<TMessages>..., nullptr};
+        Funcs[idx](obj);
+    }
+
+    template <typename TMsg, typename TVisitor>
+    static void visitOne(void* obj, TVisitor& visitor)
+    {
+        visitor(*static_cast<TMsg*>(obj));
+    }
+
+    template <typename TVisitor>
+    static void visit(std::size_t idx, void* obj, TVisitor& visitor)
+    {
+        using VisitFunc = void (*)(void*, TVisitor&);
+        static const VisitFunc Funcs[sizeof...(TMessages) + 1] = {&visitOne<TMessages, TVisitor>..., nullptr};
+        Funcs[idx](obj, visitor);
+    }
+};
+
+template <typename TMsg, typename TMessages>
+struct AnyMsgIdxOf;
+
+template <typename TMsg, typename... TRest>
+struct AnyMsgIdxOf<TMsg, std::tuple<TMsg, TRest...> >
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename TMsg, typename TOther, typename... TRest>
+struct AnyMsgIdxOf<TMsg, std::tuple<TOther, TRest...> >
+{
+    static const std::size_t Value = AnyMsgIdxOf<TMsg, std::tuple<TRest...> >::Value + 1U;
+};
+
+template <typename THandler>
+struct AnyMsgDispatcher
+{
+    template <typename TMsg>
+    void operator()(TMsg& msg)
+    {
+        m_handler.handle(msg);
+    }
+
+    THandler& m_handler;
+};
+
+}  // namespace details
+
+/// @brief Holder of a single input message of any type from the provided list.
+/// @details Similar to @b std::variant, the message object is stored inside
+///     the holder itself, the storage is sized at compile time to fit the
+///     largest message type. The stored message is accessed via
+///     @ref visit() or @ref dispatch(), which select the concrete message type
+///     by its index using compile time generated tables. No virtual
+///     function is invoked. The ID of the message is mapped to the type
+///     using ublox::MsgIdTable.
+///
+///     As the holder doesn't require any heap allocation by itself, the
+///     decoded messages can be kept in preallocated containers (such as ring
+///     buffers) and moved between threads. Note that list fields of the
+///     messages may still allocate memory unless
+///     ublox::StaticInputMessages are used.
+///     @code
+///     using AnyMsg = ublox::AnyInputMessage<ublox::InputMessages<MyInputMessage> >;
+///     AnyMsg msg;
+///     const std::uint8_t* iter = frame;
+///     auto es = msg.read(iter, len);
+///     if (es == comms::ErrorStatus::Success) {
+///         msg.dispatch(handler); // calls handler.handle(ublox::message::NavPvt<...>&), etc...
+///     }
+///     @endcode
+/// @tparam TMessages Types of all the messages that can be stored, bundled
+///     in std::tuple. Every message must be defined with
+///     @b comms::option::StaticNumIdImpl option. Reading requires the message
+///     interface to use <b>const std::uint8_t*</b> as its read iterator.
+template <typename TMessages>
+class AnyInputMessage
+{
+    using Traits = details::AnyMsgTraits<TMessages>;
+    using Ops = details::AnyMsgOps<TMessages>;
+    using Table = MsgIdTable<TMessages>;
+
+public:
+    /// @brief All the supported message types bundled in std::tuple.
+    using AllMessages = TMessages;
+
+    /// @brief Size of the storage area.
+    static const std::size_t StorageSize = Traits::Size;
+
+    /// @brief Index returned by @ref index() when no message is stored.
+    static const std::size_t NoMessage = Table::NotFound;
+
+    /// @brief Index of the message type in @ref AllMessages tuple.
+    template <typename TMsg>
+    static constexpr std::size_t indexOf()
+    {
+        return details::AnyMsgIdxOf<TMsg, TMessages>::Value;
+    }
+
+    /// @brief Default constructor, no message is stored.
+    AnyInputMessage() = default;
+
+    /// @brief Copy constructor.
+    AnyInputMessage(const AnyInputMessage& other)
+    {
+        if (!other.empty()) {
+            Ops::copy(other.m_idx, &m_storage, &other.m_storage);
+            m_idx = other.m_idx;
+        }
+    }
+
+    /// @brief Move constructor.
+    /// @details The message types are expected to have non-throwing move
+    ///     constructors, which allows containers of the holders to move them
+    ///     instead of copying on reallocation.
+    AnyInputMessage(AnyInputMessage&& other) noexcept
+    {
+        if (!other.empty()) {
+            Ops::move(other.m_idx, &m_storage, &other.m_storage);
+            m_idx = other.m_idx;
+        }
+    }
+
+    /// @brief Destructor.
+    ~AnyInputMessage()
+    {
+        reset();
+    }
+
+    /// @brief Copy assignment.
+    AnyInputMessage& operator=(const AnyInputMessage& other)
+    {
+        if (this != &other) {
+            reset();
+            if (!other.empty()) {
+                Ops::copy(other.m_idx, &m_storage, &other.m_storage);
+                m_idx = other.m_idx;
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment.
+    AnyInputMessage& operator=(AnyInputMessage&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            if (!other.empty()) {
+                Ops::move(other.m_idx, &m_storage, &other.m_storage);
+                m_idx = other.m_idx;
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Check whether no message is stored.
+    bool empty() const
+    {
+        return m_idx == NoMessage;
+    }
+
+    /// @brief Get index of the stored message type in @ref AllMessages tuple.
+    /// @return @ref NoMessage if empty.
+    std::size_t index() const
+    {
+        return m_idx;
+    }
+
+    /// @brief Get ID of the stored message.
+    /// @pre The holder is not empty.
+    MsgId id() const
+    {
+        GASSERT(!empty());
+        return Table::msgId(m_idx);
+    }
+
+    /// @brief Destruct the stored message, if any.
+    void reset()
+    {
+        if (!empty()) {
+            Ops::destroy(m_idx, &m_storage);
+            m_idx = NoMessage;
+        }
+    }
+
+    /// @brief Replace the stored message with the default constructed one
+    ///     of specified type.
+    template <typename TMsg>
+    TMsg& emplace()
+    {
+        reset();
+        auto* msg = new (&m_storage) TMsg;
+        m_idx = indexOf<TMsg>();
+        return *msg;
+    }
+
+    /// @brief Replace the stored message with the default constructed one
+    ///     with specified index in @ref AllMessages tuple.
+    void emplace(std::size_t idx)
+    {
+        GASSERT(idx < Table::NumOfMessages);
+        reset();
+        Ops::construct(idx, &m_storage);
+        m_idx = idx;
+    }
+
+    /// @brief Get pointer to the stored message of specified type.
+    /// @return @b nullptr if the stored message is of different type.
+    template <typename TMsg>
+    TMsg* get()
+    {
+        if (m_idx != indexOf<TMsg>()) {
+            return nullptr;
+        }
+        return static_cast<TMsg*>(static_cast<void*>(&m_storage));
+    }
+
+    /// @brief Get pointer to the stored message of specified type (const version).
+    template <typename TMsg>
+    const TMsg* get() const
+    {
+        if (m_idx != indexOf<TMsg>()) {
+            return nullptr;
+        }
+        return static_cast<const TMsg*>(static_cast<const void*>(&m_storage));
+    }
+
+    /// @brief Invoke provided function object with the stored message.
+    /// @details The function object is invoked with the reference to the
+    ///     concrete message type, i.e. it is expected to be either generic
+    ///     lambda or define @b operator() for every message type. Nothing is
+    ///     invoked when the holder is empty.
+    template <typename TVisitor>
+    void visit(TVisitor&& visitor)
+    {
+        if (!empty()) {
+            Ops::visit(m_idx, &m_storage, visitor);
+        }
+    }
+
+    /// @brief Dispatch the stored message to the handler.
+    /// @details Invokes @b handle() member function of the handler with
+    ///     the reference to the concrete message type, similar to @b dispatch()
+    ///     member function of the message interface, but without virtual call.
+    template <typename THandler>
+    void dispatch(THandler& handler)
+    {
+        details::AnyMsgDispatcher<THandler> dispatcher{handler};
+        visit(dispatcher);
+    }
+
+    /// @brief Read the message from the full frame.
+    /// @details Validates the transport information (see ublox::protocol::checkFrame()),
+    ///     then constructs and reads the message of appropriate type. If
+    ///     multiple types share the same ID, they are tried in order of their
+    ///     appearance in @ref AllMessages until one of them reads successfully.
+    /// @param[in, out] iter Iterator pointing to the first synchronisation byte,
+    ///     advanced past the frame if it is valid.
+    /// @param[in] size Number of bytes available for reading.
+    /// @return Status of the operation, the holder is empty on error.
+    ///     comms::ErrorStatus::NotEnoughData is reported only for incomplete
+    ///     frame, the payload too short for the message type of the valid
+    ///     frame results in comms::ErrorStatus::ProtocolError.
+    comms::ErrorStatus read(const std::uint8_t*& iter, std::size_t size)
+    {
+        reset();
+        auto* frame = iter;
+        auto es = protocol::checkFrame(frame, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto payloadLen = protocol::framePayloadLength(frame);
+        iter += protocol::frameLength(frame);
+
+        auto idx = Table::find(protocol::frameMsgId(frame));
+        if (idx == Table::NotFound) {
+            return comms::ErrorStatus::InvalidMsgId;
+        }
+
+        do {
+            emplace(idx);
+            auto payloadIter = frame + protocol::FrameHeaderLength;
+            es = readPayload(payloadIter, payloadLen);
+            if (es == comms::ErrorStatus::Success) {
+                return es;
+            }
+
+            idx = Table::next(idx);
+        } while (idx != Table::NotFound);
+
+        reset();
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            // The whole frame is already consumed, the payload is too short
+            // for its message type
+            es = comms::ErrorStatus::ProtocolError;
+        }
+        return es;
+    }
+
+private:
+    struct PayloadReader
+    {
+        template <typename TMsg>
+        void operator()(TMsg& msg)
+        {
+            m_es = fastRead(msg, m_iter, m_len);
+        }
+
+        const std::uint8_t*& m_iter;
+        std::size_t m_len;
+        comms::ErrorStatus m_es;
+    };
+
+    comms::ErrorStatus readPayload(const std::uint8_t*& iter, std::size_t len)
+    {
+        PayloadReader reader{iter, len, comms::ErrorStatus::Success};
+        visit(reader);
+        return reader.m_es;
+    }
+
+    using Storage = typename std::aligned_storage<Traits::Size, Traits::Align>::type;
+
+    Storage m_storage;
+    std::size_t m_idx = NoMessage;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,371 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::DecodePipeline class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "FrameSplitter.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+/// @brief Multi-threaded decoder of the incoming stream of raw bytes.
+/// @details Consists of three stages:
+///     @li The splitter (ublox::FrameSplitter) finds valid frames in the
+///         data passed to @ref process() and distributes copies of them
+///         among the workers in round robin order.
+///     @li Every worker runs in its own thread and decodes the frames into
+///         message objects using its own instance of the protocol stack.
+///     @li The sequencer (@ref poll()) collects the decoded messages from the
+///         workers in the same round robin order and dispatches them to the
+///         handler. As the result the messages are delivered in the original
+///         stream order.
+///
+///     Every worker owns a fixed capacity ring of frame slots with three
+///     cursors: filled by the splitter, decoded by the worker and delivered
+///     by the sequencer. Every cursor is advanced by a single thread only,
+///     so there are no locks involved while the frames keep coming. The worker
+///     that has nothing to decode spins for a short while and then parks
+///     on its condition variable, the splitter wakes it up when
+///     the next frame is submitted. The slots are reused, i.e. once their
+///     buffers have grown to accommodate the received frames, no memory is
+///     allocated apart from the message objects themselves.
+///
+///     @ref process() and @ref poll() are expected to be called from
+///     the same thread, the handler is invoked in that thread only.
+///     @code
+///     ublox::DecodePipeline<ProtStack, Handler> pipeline(handler, 4);
+///     void onDataReceived(const std::uint8_t* data, std::size_t len)
+///     {
+///         ... // prepend the unprocessed tail of the previous chunk
+///         auto consumed = pipeline.process(data, len);
+///         ... // keep the unprocessed tail
+///         pipeline.poll();
+///     }
+///     @endcode
+/// @tparam TStack Protocol stack type, expected to be some variant of @ref ublox::Stack
+///     using dynamic memory allocation of the messages (no @b comms::option::InPlaceAllocation).
+///     The interface class of the input messages must use <b>const std::uint8_t*</b>
+///     as its read iterator.
+/// @tparam THandler Type of the handler object, input messages are dispatched to.
+/// @tparam TSlots Number of the frame slots per worker, must be a power of 2.
+template <typename TStack, typename THandler, std::size_t TSlots = 256>
+class DecodePipeline
+{
+    static_assert((1U < TSlots) && ((TSlots & (TSlots - 1U)) == 0U),
+        "Number of slots must be a power of 2");
+
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Type of the message handler.
+    using Handler = THandler;
+
+    /// @brief Type of the smart pointer to the decoded message.
+    using MsgPtr = typename Stack::MsgPtr;
+
+    /// @brief Constructor, starts the worker threads.
+    /// @param[in] handler Reference to the handler object, the decoded messages
+    ///     are dispatched to. The object must outlive the pipeline.
+    /// @param[in] workers Number of the worker threads, 0 means
+    ///     number of hardware threads.
+    explicit DecodePipeline(Handler& handler, std::size_t workers = 0U)
+      : m_handler(handler)
+    {
+        if (workers == 0U) {
+            workers = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        m_workers.reserve(workers);
+        for (auto idx = 0U; idx < workers; ++idx) {
+            m_workers.emplace_back(new Worker);
+        }
+
+        for (auto& w : m_workers) {
+            auto* worker = w.get();
+            worker->m_thread = std::thread(
+                [this, worker]()
+                {
+                    run(*worker);
+                });
+        }
+    }
+
+    /// @brief Destructor, stops the worker threads.
+    /// @details Frames, which have not been delivered yet, are discarded.
+    ~DecodePipeline()
+    {
+        m_stopped.store(true, std::memory_order_seq_cst);
+        for (auto& w : m_workers) {
+            wake(*w);
+        }
+
+        for (auto& w : m_workers) {
+            w->m_thread.join();
+        }
+    }
+
+    DecodePipeline(const DecodePipeline&) = delete;
+    DecodePipeline& operator=(const DecodePipeline&) = delete;
+
+    /// @brief Get number of the worker threads.
+    std::size_t workers() const
+    {
+        return m_workers.size();
+    }
+
+    /// @brief Split the data into frames and pass them to the workers.
+    /// @details When the workers are saturated, delivers the decoded messages
+    ///     (see @ref poll()) while waiting for the free slots.
+    /// @param[in] buf Buffer to process.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @return Number of processed bytes. The unprocessed tail is the beginning
+    ///     of the incomplete frame and is expected to be presented again
+    ///     when more data is available.
+    std::size_t process(const std::uint8_t* buf, std::size_t len)
+    {
+        return
+            m_splitter.forEach(
+                buf, len,
+                [this, buf](const FrameInfo& info)
+                {
+                    submit(buf + info.m_offset, info.length());
+                });
+    }
+
+    /// @brief Dispatch all the decoded messages to the handler.
+    /// @details Stops on the first message, which is not decoded yet, to
+    ///     preserve the original order.
+    /// @return Number of dispatched messages.
+    std::size_t poll()
+    {
+        std::size_t count = 0U;
+        while (m_delivered < m_submitted) {
+            auto& worker = *m_workers[m_delivered % m_workers.size()];
+            auto pos = worker.m_delivered.load(std::memory_order_relaxed);
+            if (worker.m_decoded.load(std::memory_order_acquire) == pos) {
+                break;
+            }
+
+            auto& slot = worker.m_slots[pos % TSlots];
+            if (slot.m_es == comms::ErrorStatus::Success) {
+                GASSERT(slot.m_msg);
+                slot.m_msg->dispatch(m_handler);
+                ++count;
+            }
+            else {
+                ++m_decodeErrors;
+            }
+
+            slot.m_msg.reset();
+            worker.m_delivered.store(pos + 1U, std::memory_order_release);
+            ++m_delivered;
+        }
+        return count;
+    }
+
+    /// @brief Wait until all the submitted frames are decoded and dispatched.
+    /// @return Number of dispatched messages.
+    std::size_t flush()
+    {
+        std::size_t count = 0U;
+        while (m_delivered < m_submitted) {
+            auto dispatched = poll();
+            if ((dispatched == 0U) && (m_delivered < m_submitted)) {
+                std::this_thread::yield();
+            }
+            count += dispatched;
+        }
+        return count;
+    }
+
+    /// @brief Get number of the frames submitted to the workers, but not
+    ///     delivered yet.
+    std::size_t pending() const
+    {
+        return static_cast<std::size_t>(m_submitted - m_delivered);
+    }
+
+    /// @brief Get number of the valid frames that failed to decode,
+    ///     such as ones with unknown ID.
+    std::uint64_t decodeErrors() const
+    {
+        return m_decodeErrors;
+    }
+
+    /// @brief Access the splitter.
+    /// @details Can be used to retrieve the statistics of the skipped bytes
+    ///     and frames with wrong checksum.
+    const FrameSplitter& splitter() const
+    {
+        return m_splitter;
+    }
+
+private:
+    struct Slot
+    {
+        std::vector<std::uint8_t> m_frame;
+        MsgPtr m_msg;
+        comms::ErrorStatus m_es = comms::ErrorStatus::Success;
+    };
+
+    // The padding keeps cursors modified by different threads
+    // in separate cache lines
+    static const std::size_t CacheLineLength = 64U;
+    using Padding = char[CacheLineLength];
+
+    struct Worker
+    {
+        std::vector<Slot> m_slots = std::vector<Slot>(TSlots);
+        Stack m_stack;
+        std::thread m_thread;
+        Padding m_pad1;
+        std::atomic<std::size_t> m_filled{0U};
+        Padding m_pad2;
+        std::atomic<std::size_t> m_decoded{0U};
+        Padding m_pad3;
+        std::atomic<std::size_t> m_delivered{0U};
+        Padding m_pad4;
+        std::atomic<bool> m_parked{false};
+        std::mutex m_lock;
+        std::condition_variable m_cond;
+    };
+
+    static void backoff(unsigned& idleCount)
+    {
+        static const unsigned SpinLimit = 64U;
+        static const unsigned YieldLimit = 1024U;
+        ++idleCount;
+        if (idleCount < SpinLimit) {
+            return;
+        }
+
+        if (idleCount < YieldLimit) {
+            std::this_thread::yield();
+            return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    void submit(const std::uint8_t* frame, std::size_t len)
+    {
+        auto& worker = *m_workers[m_submitted % m_workers.size()];
+        auto pos = worker.m_filled.load(std::memory_order_relaxed);
+        unsigned idleCount = 0U;
+        while ((pos - worker.m_delivered.load(std::memory_order_acquire)) == TSlots) {
+            if (poll() == 0U) {
+                backoff(idleCount);
+            }
+        }
+
+        auto& slot = worker.m_slots[pos % TSlots];
+        slot.m_frame.assign(frame, frame + len);
+        // Sequentially consistent store and load below pair with the ones in park()
+        worker.m_filled.store(pos + 1U, std::memory_order_seq_cst);
+        if (worker.m_parked.load(std::memory_order_seq_cst)) {
+            wake(worker);
+        }
+        ++m_submitted;
+    }
+
+    static void wake(Worker& worker)
+    {
+        {
+            std::lock_guard<std::mutex> guard(worker.m_lock);
+        }
+        worker.m_cond.notify_one();
+    }
+
+    // Wait until new frame is submitted or the pipeline is stopped.
+    // The parked flag is raised before the last check of the filled cursor,
+    // so the splitter either observes the flag and notifies, or the worker
+    // observes the new frame, i.e. the wake up cannot be lost.
+    void park(Worker& worker, std::size_t pos)
+    {
+        std::unique_lock<std::mutex> guard(worker.m_lock);
+        worker.m_parked.store(true, std::memory_order_seq_cst);
+        worker.m_cond.wait(
+            guard,
+            [this, &worker, pos]()
+            {
+                return
+                    (worker.m_filled.load(std::memory_order_seq_cst) != pos) ||
+                    m_stopped.load(std::memory_order_seq_cst);
+            });
+        worker.m_parked.store(false, std::memory_order_relaxed);
+    }
+
+    void run(Worker& worker)
+    {
+        using MsgType = typename MsgPtr::element_type;
+
+        static const unsigned SpinLimit = 1024U;
+        unsigned idleCount = 0U;
+        auto pos = worker.m_decoded.load(std::memory_order_relaxed);
+        while (!m_stopped.load(std::memory_order_relaxed)) {
+            if (worker.m_filled.load(std::memory_order_acquire) == pos) {
+                ++idleCount;
+                if (idleCount < SpinLimit) {
+                    continue;
+                }
+
+                park(worker, pos);
+                idleCount = 0U;
+                continue;
+            }
+
+            idleCount = 0U;
+            auto& slot = worker.m_slots[pos % TSlots];
+            const std::uint8_t* begin = slot.m_frame.data();
+            auto iter = comms::readIteratorFor<MsgType>(begin);
+            slot.m_es = worker.m_stack.read(slot.m_msg, iter, slot.m_frame.size());
+            ++pos;
+            worker.m_decoded.store(pos, std::memory_order_release);
+        }
+    }
+
+    Handler& m_handler;
+    std::vector<std::unique_ptr<Worker> > m_workers;
+    FrameSplitter m_splitter;
+    std::uint64_t m_submitted = 0U;
+    std::uint64_t m_delivered = 0U;
+    std::uint64_t m_decodeErrors = 0U;
+    std::atomic<bool> m_stopped{false};
+};
+
+}  // namespace ublox
+
+
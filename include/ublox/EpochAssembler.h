@@ -0,0 +1,360 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::EpochAssembler class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "MsgIdTable.h"
+#include "FrameSplitter.h"
+#include "NavTime.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+/// @brief Assembler of the input messages into navigation epochs.
+/// @details The receiver reports single navigation solution as a sequence
+///     of @b NAV messages (NAV-PVT, NAV-SAT, NAV-DOP, NAV-CLOCK, ...) sharing
+///     the same @b iTOW, which is terminated by NAV-EOE on newer firmware.
+///     The assembler splits the incoming data into frames (see ublox::FrameSplitter),
+///     decodes them using the protocol stack and groups the messages into the
+///     epoch bundle (see @ref Epoch). The bundle is reported to the provided
+///     function when:
+///     @li NAV-EOE is received (the epoch is @ref Epoch::complete()).
+///     @li @b NAV message with different @b iTOW is received, i.e. the next
+///         epoch has started. The @b iTOW is taken from the raw payload using
+///         ublox::readNavTow().
+///     @li The epoch has been assembled longer than the timeout (see @ref setTimeout()),
+///         which is checked upon arrival of the new data and by @ref checkTimeout().
+///
+///     The messages that don't report @b iTOW (such as messages of other classes) are added to
+///     the epoch being assembled. The same bundle object is reused for all the
+///     epochs, its storage is reserved upon construction, so no memory is
+///     allocated apart from the message objects themselves (see
+///     ublox::PooledMessages to avoid that as well).
+///     @code
+///     ublox::EpochAssembler<ProtStack> assembler;
+///     auto func =
+///         [](ublox::EpochAssembler<ProtStack>::Epoch& epoch)
+///         {
+///             auto* pvt = epoch.find<ublox::message::NavPvt<MyMessage> >();
+///             ...
+///         };
+///     auto consumed = assembler.process(data, len, func);
+///     ...
+///     assembler.checkTimeout(func); // Periodically
+///     @endcode
+/// @tparam TStack Protocol stack type, expected to be some variant of @ref ublox::Stack
+///     using dynamic memory allocation of the messages (no @b comms::option::InPlaceAllocation).
+///     The interface class of the input messages must use <b>const std::uint8_t*</b>
+///     as its read iterator. The stack is expected to expose the tuple of
+///     all its message types as @b AllMessages (the same way the COMMS
+///     protocol layers do).
+template <typename TStack>
+class EpochAssembler
+{
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Type of the smart pointer to the decoded message.
+    using MsgPtr = typename Stack::MsgPtr;
+
+    /// @brief Type of the message interface class.
+    using MsgType = typename MsgPtr::element_type;
+
+    /// @brief Type of the clock used to measure the timeout.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Type of the timeout duration.
+    using Duration = Clock::duration;
+
+    /// @brief Default number of the messages in the epoch to reserve storage for.
+    static const std::size_t DefaultCapacity = 32U;
+
+    /// @brief Bundle of the messages of single navigation epoch.
+    class Epoch
+    {
+    public:
+        /// @brief Value of unknown time of week.
+        static const std::uint32_t UnknownTow = std::numeric_limits<std::uint32_t>::max();
+
+        /// @brief GPS time of week of the epoch in milliseconds.
+        /// @details @ref UnknownTow if no @b NAV message has been received.
+        std::uint32_t iTOW() const
+        {
+            return m_iTOW;
+        }
+
+        /// @brief Check whether the epoch has been terminated by NAV-EOE.
+        bool complete() const
+        {
+            return m_complete;
+        }
+
+        /// @brief Get number of the messages.
+        std::size_t size() const
+        {
+            return m_msgs.size();
+        }
+
+        /// @brief Check whether the epoch has no messages.
+        bool empty() const
+        {
+            return m_msgs.empty();
+        }
+
+        /// @brief Get all the messages in order of their arrival.
+        /// @details The messages can be moved out, the bundle is cleared
+        ///     once it has been reported.
+        std::vector<MsgPtr>& messages()
+        {
+            return m_msgs;
+        }
+
+        /// @brief Get ID of the message with specified index.
+        MsgId id(std::size_t idx) const
+        {
+            return m_ids[idx];
+        }
+
+        /// @brief Find the first message with specified ID.
+        /// @return Pointer to the message, @b nullptr if not found.
+        MsgType* find(MsgId msgId) const
+        {
+            for (auto idx = 0U; idx < m_ids.size(); ++idx) {
+                if (m_ids[idx] == msgId) {
+                    return m_msgs[idx].get();
+                }
+            }
+            return nullptr;
+        }
+
+        /// @brief Find the first message of specified type.
+        /// @details The message is looked up by the ID of its type, so the ID
+        ///     must not be shared with other message types handled by the protocol
+        ///     stack (such as ublox::message::NavAopstatus and
+        ///     ublox::message::NavAopstatusU8), which is checked at compile time.
+        ///     Use @ref find(MsgId) and distinguish such messages by other means.
+        /// @tparam TMsg Type of the message, must be defined with
+        ///     @b comms::option::StaticNumIdImpl option.
+        /// @return Pointer to the message, @b nullptr if not found.
+        template <typename TMsg>
+        TMsg* find() const
+        {
+            using Table = MsgIdTable<typename Stack::AllMessages>;
+            static_assert(std::is_base_of<MsgType, TMsg>::value,
+                "The message must be derived from the interface class of the stack");
+            static_assert(Table::count(static_cast<MsgId>(details::MsgIdOf<TMsg>::Value)) == 1U,
+                "The message ID must identify single message type of the stack");
+            return static_cast<TMsg*>(find(static_cast<MsgId>(details::MsgIdOf<TMsg>::Value)));
+        }
+
+    private:
+        friend class EpochAssembler;
+
+        explicit Epoch(std::size_t capacity)
+        {
+            m_msgs.reserve(capacity);
+            m_ids.reserve(capacity);
+        }
+
+        void add(MsgId msgId, MsgPtr&& msgPtr)
+        {
+            m_ids.push_back(msgId);
+            m_msgs.push_back(std::move(msgPtr));
+        }
+
+        void clear()
+        {
+            m_msgs.clear();
+            m_ids.clear();
+            m_iTOW = UnknownTow;
+            m_complete = false;
+            m_open = false;
+        }
+
+        std::vector<MsgPtr> m_msgs;
+        std::vector<MsgId> m_ids;
+        Clock::time_point m_started;
+        std::uint32_t m_iTOW = UnknownTow;
+        bool m_complete = false;
+        bool m_open = false;
+    };
+
+    /// @brief Constructor.
+    /// @param[in] capacity Number of the messages in the epoch to reserve storage for.
+    explicit EpochAssembler(std::size_t capacity = DefaultCapacity)
+      : m_epoch(capacity)
+    {
+    }
+
+    /// @brief Set the timeout of the epoch assembly.
+    /// @details Used with firmware that doesn't report NAV-EOE. The epoch
+    ///     is reported when the timeout has expired since reception of its
+    ///     first message. Default value is 500 milliseconds.
+    void setTimeout(Duration timeout)
+    {
+        m_timeout = timeout;
+    }
+
+    /// @brief Get the timeout of the epoch assembly.
+    Duration timeout() const
+    {
+        return m_timeout;
+    }
+
+    /// @brief Check whether some messages are waiting for the epoch to be completed.
+    bool pending() const
+    {
+        return m_epoch.m_open;
+    }
+
+    /// @brief Get access to the protocol stack.
+    Stack& stack()
+    {
+        return m_stack;
+    }
+
+    /// @brief Process the incoming data.
+    /// @param[in] buf Buffer to process.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @param[in] func Function with <b>void (Epoch&)</b> signature, which
+    ///     is invoked for every assembled epoch.
+    /// @return Number of processed bytes. The unprocessed tail is expected to
+    ///     be presented again when more data is available.
+    template <typename TFunc>
+    std::size_t process(const std::uint8_t* buf, std::size_t len, TFunc&& func)
+    {
+        auto now = Clock::now();
+        checkTimeout(now, func);
+        return
+            m_splitter.forEach(
+                buf, len,
+                [this, buf, now, &func](const FrameInfo& info)
+                {
+                    addFrame(buf + info.m_offset, info, now, func);
+                });
+    }
+
+    /// @brief Report the epoch if its assembly timeout has expired.
+    /// @details Expected to be called periodically, when no data is received.
+    template <typename TFunc>
+    void checkTimeout(TFunc&& func)
+    {
+        checkTimeout(Clock::now(), func);
+    }
+
+    /// @brief Report the epoch if its assembly timeout has expired.
+    /// @param[in] now Current time.
+    /// @param[in] func Function with <b>void (Epoch&)</b> signature.
+    template <typename TFunc>
+    void checkTimeout(Clock::time_point now, TFunc&& func)
+    {
+        if (m_epoch.m_open && (m_timeout <= (now - m_epoch.m_started))) {
+            report(func);
+        }
+    }
+
+    /// @brief Report the epoch being assembled regardless of the timeout.
+    template <typename TFunc>
+    void flush(TFunc&& func)
+    {
+        if (m_epoch.m_open) {
+            report(func);
+        }
+    }
+
+private:
+    template <typename TFunc>
+    void addFrame(const std::uint8_t* frame, const FrameInfo& info, Clock::time_point now, TFunc& func)
+    {
+        // The epoch boundaries are detected from the raw frame, so they
+        // don't depend on the message types known to the protocol stack
+        auto iTOW = Epoch::UnknownTow;
+        readNavTow(info.m_id, frame + protocol::FrameHeaderLength, info.m_payloadLen, iTOW);
+
+        if ((iTOW != Epoch::UnknownTow) &&
+            (m_epoch.m_iTOW != Epoch::UnknownTow) &&
+            (iTOW != m_epoch.m_iTOW)) {
+            close(func);
+        }
+
+        if (iTOW != Epoch::UnknownTow) {
+            m_epoch.m_iTOW = iTOW;
+        }
+
+        MsgPtr msgPtr;
+        auto readIter = comms::readIteratorFor<MsgType>(frame);
+        auto es = m_stack.read(msgPtr, readIter, info.length());
+        if (es == comms::ErrorStatus::Success) {
+            GASSERT(msgPtr);
+            if (!m_epoch.m_open) {
+                m_epoch.m_open = true;
+                m_epoch.m_started = now;
+            }
+
+            m_epoch.add(info.m_id, std::move(msgPtr));
+        }
+
+        if (info.m_id == MsgId_NAV_EOE) {
+            m_epoch.m_complete = true;
+            close(func);
+        }
+    }
+
+    // Report the epoch if it contains any message, drop the collected time otherwise
+    template <typename TFunc>
+    void close(TFunc& func)
+    {
+        if (m_epoch.m_open) {
+            report(func);
+            return;
+        }
+
+        m_epoch.clear();
+    }
+
+    template <typename TFunc>
+    void report(TFunc& func)
+    {
+        func(m_epoch);
+        m_epoch.clear();
+    }
+
+    Stack m_stack;
+    FrameSplitter m_splitter;
+    Epoch m_epoch;
+    Duration m_timeout = std::chrono::milliseconds(500);
+};
+
+}  // namespace ublox
+
+
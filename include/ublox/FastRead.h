@@ -0,0 +1,215 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of fast read path for the messages with fixed layout.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MessageView.h"
+#include "MessagePool.h"
+#include "message/NavPosecef.h"
+#include "message/NavPosllh.h"
+#include "message/NavVelned.h"
+#include "message/NavClock.h"
+#include "message/NavDop.h"
+#include "message/NavTimeutc.h"
+#include "message/TimTp.h"
+#include "message/MonRxbuf.h"
+
+#if !defined(UBLOX_NO_FAST_READ)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define UBLOX_FAST_READ_LITTLE_ENDIAN
+#endif
+#elif defined(_MSC_VER)
+#define UBLOX_FAST_READ_LITTLE_ENDIAN
+#endif
+#endif
+
+namespace ublox
+{
+
+/// @brief Compile time indication of the message type eligible for
+///     the fast read (see ublox::fastRead()).
+/// @details The message must have fixed serialisation length and must not
+///     customise its read operation. Specialise it for other such messages.
+///     The ublox::PooledMessage wrappers (see ublox::PooledMessages) inherit
+///     the indication of the wrapped message type.
+template <typename TMsg>
+struct FastReadEnabled : public std::false_type
+{
+};
+
+/// @cond DOCUMENT_FAST_READ_SPECIALISATIONS
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavPosecef<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavPosllh<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavVelned<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavClock<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavDop<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::NavTimeutc<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase>
+struct FastReadEnabled<message::TimTp<TMsgBase> > : public std::true_type {};
+
+template <typename TMsgBase, typename TOpt>
+struct FastReadEnabled<message::MonRxbuf<TMsgBase, TOpt> > : public std::true_type {};
+
+template <typename TMsg, std::size_t TCapacity>
+struct FastReadEnabled<PooledMessage<TMsg, TCapacity> > : public FastReadEnabled<TMsg> {};
+/// @endcond
+
+namespace details
+{
+
+// The value of the field can be copied directly from the little endian
+// serialised data
+template <typename TField>
+constexpr bool fastReadIsPlain()
+{
+    return
+        (std::is_integral<typename TField::ValueType>::value ||
+         std::is_enum<typename TField::ValueType>::value) &&
+        (sizeof(typename TField::ValueType) == TField::maxLength()) &&
+        (TField::minLength() == TField::maxLength());
+}
+
+template <typename TFields, std::size_t TCount = std::tuple_size<TFields>::value>
+struct FastReadLength
+{
+    using LastField = typename std::tuple_element<TCount - 1, TFields>::type;
+    static_assert(LastField::minLength() == LastField::maxLength(),
+        "All the fields must have fixed length");
+
+    static const std::size_t Value = FastReadLength<TFields, TCount - 1>::Value + LastField::maxLength();
+};
+
+template <typename TFields>
+struct FastReadLength<TFields, 0U>
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename TField>
+void fastReadField(TField& field, const std::uint8_t* data, std::true_type)
+{
+    using ValueType = typename TField::ValueType;
+    ValueType value;
+    std::memcpy(&value, data, sizeof(value));
+    field.value() = value;
+}
+
+template <typename TField>
+void fastReadField(TField& field, const std::uint8_t* data, std::false_type)
+{
+    auto es = field.read(data, TField::maxLength());
+    static_cast<void>(es);
+    GASSERT(es == comms::ErrorStatus::Success);
+}
+
+template <typename TFields, std::size_t TIdx, std::size_t TCount>
+struct FastReadFields
+{
+    static void read(TFields& fields, const std::uint8_t* data)
+    {
+        using Field = typename std::tuple_element<TIdx, TFields>::type;
+        using Tag = std::integral_constant<bool, fastReadIsPlain<Field>()>;
+        fastReadField(std::get<TIdx>(fields), data + ViewFieldOffset<TFields, TIdx>::Value, Tag());
+        FastReadFields<TFields, TIdx + 1, TCount>::read(fields, data);
+    }
+};
+
+template <typename TFields, std::size_t TCount>
+struct FastReadFields<TFields, TCount, TCount>
+{
+    static void read(TFields&, const std::uint8_t*)
+    {
+    }
+};
+
+template <typename TMsg>
+comms::ErrorStatus fastReadInternal(TMsg& msg, const std::uint8_t*& iter, std::size_t len, std::true_type)
+{
+    using AllFields = typename TMsg::AllFields;
+    static const std::size_t MsgLen = FastReadLength<AllFields>::Value;
+    if (len < MsgLen) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    FastReadFields<AllFields, 0U, std::tuple_size<AllFields>::value>::read(msg.fields(), iter);
+    iter += MsgLen;
+    return comms::ErrorStatus::Success;
+}
+
+template <typename TMsg>
+comms::ErrorStatus fastReadInternal(TMsg& msg, const std::uint8_t*& iter, std::size_t len, std::false_type)
+{
+    return msg.read(iter, len);
+}
+
+}  // namespace details
+
+/// @brief Read the message payload using fast path if possible.
+/// @details For the message types marked by ublox::FastReadEnabled on
+///     little endian platforms, the offsets of all the fields are calculated at
+///     compile time, and values of the plain numeric fields are copied directly
+///     from the payload with @b memcpy (which the compiler merges into plain
+///     loads), without bounds checks per field and byte by byte assembly of the
+///     values. The fields with different serialised representation (bitfields,
+///     3 bytes integers, fixed size lists) are read by their own @b read() member
+///     function. The result is identical to the normal read.
+///
+///     Other message types are read using @b read() member function of the
+///     message. Define @b UBLOX_NO_FAST_READ to disable the fast path.
+/// @param[out] msg Message object.
+/// @param[in, out] iter Iterator to the payload, advanced past the read data.
+/// @param[in] len Length of the payload.
+/// @return Status of the operation.
+template <typename TMsg>
+comms::ErrorStatus fastRead(TMsg& msg, const std::uint8_t*& iter, std::size_t len)
+{
+#if defined(UBLOX_FAST_READ_LITTLE_ENDIAN)
+    using Tag = std::integral_constant<bool, FastReadEnabled<TMsg>::value>;
+#else
+    using Tag = std::false_type;
+#endif
+    return details::fastReadInternal(msg, iter, len, Tag());
+}
+
+}  // namespace ublox
+
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::FilteredStack class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MsgIdFilter.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+/// @brief Protocol stack with filtering of the messages by their IDs.
+/// @details Wraps any variant of the protocol stack (ublox::Stack,
+///     ublox::TableStack, ublox::StaticStack) and checks the ID of the incoming
+///     frame against the runtime configurable ublox::MsgIdFilter before
+///     the frame is passed to the wrapped stack. The rejected frames
+///     have their length and checksum verified and are skipped without
+///     creating any message object, the @b read() operation reports
+///     @b comms::ErrorStatus::InvalidMsgId for them, the same way as for
+///     messages which are not known to the stack. The drops
+///     are counted by the filter.
+///     @code
+///     ublox::FilteredStack<ProtStack> stack;
+///     stack.filter().rejectAll();
+///     stack.filter().accept(ublox::MsgId_NAV_PVT);
+///     stack.filter().acceptClass(0x05); // ACK-*
+///     @endcode
+///     The filtering is applied only when reading from <b>const std::uint8_t*</b>
+///     iterator, reads with other iterators and all the other operations
+///     are forwarded to the wrapped stack unchanged.
+/// @tparam TStack Type of the wrapped protocol stack.
+template <typename TStack>
+class FilteredStack : public TStack
+{
+    using Base = TStack;
+
+public:
+    /// @brief Type of smart pointer holding allocated message object.
+    using MsgPtr = typename Base::MsgPtr;
+
+    /// @brief Access the filter.
+    MsgIdFilter& filter()
+    {
+        return m_filter;
+    }
+
+    /// @brief Access the filter (const version).
+    const MsgIdFilter& filter() const
+    {
+        return m_filter;
+    }
+
+    /// @brief Deserialise message from the input data sequence.
+    /// @details Has the same semantics as @b read() member function of the
+    ///     wrapped stack.
+    /// @param[out] msgPtr Reference to smart pointer that will hold
+    ///     allocated message object.
+    /// @param[in, out] iter Input iterator.
+    /// @param[in] size Size of the data in the sequence.
+    /// @param[out] missingSize If not nullptr and return value is
+    ///     comms::ErrorStatus::NotEnoughData it will contain minimal
+    ///     missing data length required for the successful read attempt.
+    /// @return Status of the operation.
+    template <typename TIter>
+    comms::ErrorStatus read(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<TIter, const std::uint8_t*>::value,
+                FilterReadTag,
+                BaseReadTag
+            >::type;
+        return readInternal(msgPtr, iter, size, missingSize, Tag());
+    }
+
+private:
+    struct FilterReadTag {};
+    struct BaseReadTag {};
+
+    template <typename TIter>
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        BaseReadTag)
+    {
+        return Base::read(msgPtr, iter, size, missingSize);
+    }
+
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        const std::uint8_t*& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        FilterReadTag)
+    {
+        auto* frame = iter;
+        bool headerPresent =
+            (protocol::FrameHeaderLength <= size) &&
+            (frame[0] == protocol::SyncChar1) &&
+            (frame[1] == protocol::SyncChar2);
+
+        if ((!headerPresent) || m_filter.accepts(protocol::frameMsgId(frame))) {
+            return Base::read(msgPtr, iter, size, missingSize);
+        }
+
+        auto es = protocol::checkFrame(frame, size);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            if (missingSize != nullptr) {
+                *missingSize = protocol::frameLength(frame) - size;
+            }
+            return es;
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        m_filter.recordDrop(protocol::frameMsgId(frame));
+        iter += protocol::frameLength(frame);
+        return comms::ErrorStatus::InvalidMsgId;
+    }
+
+    MsgIdFilter m_filter;
+};
+
+}  // namespace ublox
+
+
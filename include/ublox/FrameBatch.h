@@ -0,0 +1,182 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::FrameBatch class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "FrameSplitter.h"
+#include "FrameWriter.h"
+
+namespace ublox
+{
+
+/// @brief Batch of the serialised output frames.
+/// @details Serialises multiple (possibly different) output messages back
+///     to back into a single contiguous buffer (arena), using single pass
+///     ublox::writeFrame(). The whole batch is then sent to the device with
+///     a single call to the write function instead of write + flush per message.
+///     The arena and the list of the frames are reused between the bursts, i.e.
+///     no memory allocation is expected once the capacity is large enough.
+/// @code
+/// ublox::FrameBatch batch;
+/// batch.add(cfgPrtUsbMsg);
+/// batch.add(cfgMsgMsg);
+/// batch.add(cfgRateMsg);
+/// batch.flush(
+///     [&serial](const std::uint8_t* data, std::size_t len)
+///     {
+///         serial.write(reinterpret_cast<const char*>(data), len);
+///     });
+/// @endcode
+///     The list of the batched frames (see @ref frames()) can be used to
+///     correlate received ACK-ACK / ACK-NAK messages with the sent ones.
+///     It is retained after @ref flush() until the next @ref add() or @ref clear().
+class FrameBatch
+{
+public:
+    /// @brief Type of the arena storage.
+    using Storage = std::vector<std::uint8_t>;
+
+    /// @brief Type of the frames list.
+    using FramesList = std::vector<FrameInfo>;
+
+    /// @brief Pre-allocate arena and frames list.
+    /// @param[in] bytes Expected total number of bytes in the batch.
+    /// @param[in] frames Expected number of frames in the batch.
+    void reserve(std::size_t bytes, std::size_t frames)
+    {
+        m_data.reserve(bytes);
+        m_frames.reserve(frames);
+    }
+
+    /// @brief Serialise the message at the end of the batch.
+    /// @tparam TMsg Concrete message type, see ublox::writeFrame().
+    /// @details The first call after @ref flush() discards the frames
+    ///     of the sent batch.
+    /// @return Status of the write operation. Nothing is added to the
+    ///     batch on error.
+    template <typename TMsg>
+    comms::ErrorStatus add(const TMsg& msg)
+    {
+        if (m_sent) {
+            clear();
+        }
+
+        auto offset = m_data.size();
+        auto iter = std::back_inserter(m_data);
+        auto es = writeFrame(msg, iter, m_data.max_size() - offset);
+        if (es != comms::ErrorStatus::Success) {
+            m_data.resize(offset);
+            return es;
+        }
+
+        FrameInfo info;
+        info.m_offset = offset;
+        info.m_id = protocol::frameMsgId(&m_data[offset]);
+        info.m_payloadLen = static_cast<std::uint16_t>(protocol::framePayloadLength(&m_data[offset]));
+        m_frames.push_back(info);
+        return es;
+    }
+
+    /// @brief Check whether the batch is empty.
+    bool empty() const
+    {
+        return m_frames.empty();
+    }
+
+    /// @brief Check whether the batched frames have already been sent with @ref flush().
+    bool sent() const
+    {
+        return m_sent;
+    }
+
+    /// @brief Get number of batched bytes.
+    std::size_t size() const
+    {
+        return m_data.size();
+    }
+
+    /// @brief Get pointer to the batched bytes.
+    const std::uint8_t* data() const
+    {
+        return m_data.data();
+    }
+
+    /// @brief Get list of the batched frames in order of their addition.
+    /// @details The offsets are relative to @ref data().
+    const FramesList& frames() const
+    {
+        return m_frames;
+    }
+
+    /// @brief Find first batched frame with the specified ID.
+    /// @details Can be used to match the @b clsID and @b msgID
+    ///     fields of the received ACK-ACK or ACK-NAK message.
+    /// @return Pointer to the frame info, @b nullptr if not found.
+    const FrameInfo* find(MsgId id) const
+    {
+        for (auto& info : m_frames) {
+            if (info.m_id == id) {
+                return &info;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Send all the batched frames with a single call.
+    /// @details The sent frames remain accessible via @ref frames() and
+    ///     @ref find() for correlation with the replies, until the next
+    ///     @ref add() or @ref clear().
+    /// @param[in] func Write function with <b>void (const std::uint8_t*, std::size_t)</b>
+    ///     signature. It is not invoked when the batch is empty or has
+    ///     already been sent.
+    template <typename TFunc>
+    void flush(TFunc&& func)
+    {
+        if ((!m_sent) && (!m_data.empty())) {
+            func(static_cast<const std::uint8_t*>(m_data.data()), m_data.size());
+        }
+        m_sent = true;
+    }
+
+    /// @brief Discard all the batched frames, the allocated capacity is retained.
+    void clear()
+    {
+        m_data.clear();
+        m_frames.clear();
+        m_sent = false;
+    }
+
+private:
+    Storage m_data;
+    FramesList m_frames;
+    bool m_sent = false;
+};
+
+}  // namespace ublox
+
+
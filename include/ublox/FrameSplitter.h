@@ -0,0 +1,162 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::FrameSplitter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "protocol/Frame.h"
+#include "protocol/Resync.h"
+
+namespace ublox
+{
+
+/// @brief Location and identification of a single valid frame.
+/// @see ublox::FrameSplitter
+struct FrameInfo
+{
+    std::size_t m_offset = 0U; ///< Offset of the first synchronisation byte in the buffer
+    MsgId m_id = MsgId(); ///< ID (class and ID) of the message
+    std::uint16_t m_payloadLen = 0U; ///< Length of the message payload
+
+    /// @brief Full length of the frame, including transport information.
+    std::size_t length() const
+    {
+        return static_cast<std::size_t>(m_payloadLen) + protocol::FrameOverheadLength;
+    }
+};
+
+/// @brief Splitter of the raw data into UBX frames.
+/// @details Finds all the valid frames in the provided buffer, checking
+///     synchronisation bytes, length and checksum of every frame.
+///     Unlike the full protocol stack (@ref ublox::Stack), it never
+///     creates any message object or decodes the message payload. It can be
+///     used to route, filter or archive frames by their IDs.
+///     The garbage between the frames is skipped using ublox::protocol::findSync().
+///
+///     The splitter is stateless with regard to the processed data, but
+///     accumulates statistics about the skipped bytes and rejected frames.
+class FrameSplitter
+{
+public:
+    /// @brief Invoke provided function for every valid frame in the buffer.
+    /// @details The processing stops when the remaining data is
+    ///     the beginning of the frame that is not fully present in the buffer.
+    /// @param[in] buf Buffer to process.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @param[in] func Function with <b>void (const ublox::FrameInfo&)</b> signature,
+    ///     the offset of the frame is relative to the @b buf.
+    /// @return Number of processed bytes. The unprocessed tail is expected to
+    ///     be presented again when more data is available.
+    template <typename TFunc>
+    std::size_t forEach(const std::uint8_t* buf, std::size_t len, TFunc&& func)
+    {
+        auto* end = buf + len;
+        auto* iter = buf;
+        while (iter < end) {
+            if (*iter != protocol::SyncChar1) {
+                iter += m_resync.skipGarbage(iter, static_cast<std::size_t>(end - iter));
+                continue;
+            }
+
+            auto remLen = static_cast<std::size_t>(end - iter);
+            auto es = protocol::checkFrame(iter, remLen);
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                break;
+            }
+
+            if (es != comms::ErrorStatus::Success) {
+                if ((1U < remLen) && (iter[1] == protocol::SyncChar2)) {
+                    ++m_badChecksums;
+                }
+                iter += m_resync.skip(iter, remLen);
+                continue;
+            }
+
+            FrameInfo info;
+            info.m_offset = static_cast<std::size_t>(iter - buf);
+            info.m_id = protocol::frameMsgId(iter);
+            info.m_payloadLen = static_cast<std::uint16_t>(protocol::framePayloadLength(iter));
+            func(static_cast<const FrameInfo&>(info));
+            ++m_frames;
+            iter += info.length();
+        }
+
+        return static_cast<std::size_t>(iter - buf);
+    }
+
+    /// @brief Find all the valid frames in the buffer.
+    /// @details Same as @ref forEach(), but appends information about
+    ///     every found frame to the provided vector.
+    /// @param[in] buf Buffer to process.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @param[in, out] frames Vector to append the found frames to.
+    /// @return Number of processed bytes.
+    std::size_t split(const std::uint8_t* buf, std::size_t len, std::vector<FrameInfo>& frames)
+    {
+        return
+            forEach(
+                buf, len,
+                [&frames](const FrameInfo& info)
+                {
+                    frames.push_back(info);
+                });
+    }
+
+    /// @brief Get total number of found valid frames.
+    std::uint64_t frames() const
+    {
+        return m_frames;
+    }
+
+    /// @brief Get total number of frames rejected due to wrong checksum.
+    std::uint64_t badChecksums() const
+    {
+        return m_badChecksums;
+    }
+
+    /// @brief Get total number of bytes skipped between the valid frames.
+    std::uint64_t discarded() const
+    {
+        return m_resync.discarded();
+    }
+
+    /// @brief Reset all the statistics.
+    void resetStats()
+    {
+        m_frames = 0U;
+        m_badChecksums = 0U;
+        m_resync.resetDiscarded();
+    }
+
+private:
+    protocol::Resync m_resync;
+    std::uint64_t m_frames = 0U;
+    std::uint64_t m_badChecksums = 0U;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,299 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of single pass frame serialisation functions.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+
+#include "comms/comms.h"
+
+#include "MsgIdTable.h"
+#include "protocol/Frame.h"
+#include "protocol/Resync.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TFields, std::size_t TCount = std::tuple_size<TFields>::value>
+struct FrameFieldsLength
+{
+    using LastField = typename std::tuple_element<TCount - 1, TFields>::type;
+    using Prev = FrameFieldsLength<TFields, TCount - 1>;
+
+    static const bool Fixed =
+        Prev::Fixed && (LastField::minLength() == LastField::maxLength());
+
+    static const std::size_t Value = Prev::Value + LastField::maxLength();
+};
+
+template <typename TFields>
+struct FrameFieldsLength<TFields, 0U>
+{
+    static const bool Fixed = true;
+    static const std::size_t Value = 0U;
+};
+
+template <std::size_t TIdx, std::size_t TCount>
+struct FrameFieldsOp
+{
+    template <typename TFields>
+    static std::size_t length(const TFields& fields)
+    {
+        return std::get<TIdx>(fields).length() + FrameFieldsOp<TIdx + 1, TCount>::length(fields);
+    }
+
+    template <typename TFields, typename TIter>
+    static comms::ErrorStatus write(const TFields& fields, TIter& iter)
+    {
+        auto& field = std::get<TIdx>(fields);
+        auto es = field.write(iter, field.length());
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return FrameFieldsOp<TIdx + 1, TCount>::write(fields, iter);
+    }
+};
+
+template <std::size_t TCount>
+struct FrameFieldsOp<TCount, TCount>
+{
+    template <typename TFields>
+    static std::size_t length(const TFields&)
+    {
+        return 0U;
+    }
+
+    template <typename TFields, typename TIter>
+    static comms::ErrorStatus write(const TFields&, TIter&)
+    {
+        return comms::ErrorStatus::Success;
+    }
+};
+
+template <bool TFixed>
+struct FramePayloadLengthCalc
+{
+    template <typename TMsg>
+    static std::size_t get(const TMsg&)
+    {
+        return FrameFieldsLength<typename TMsg::AllFields>::Value;
+    }
+};
+
+template <>
+struct FramePayloadLengthCalc<false>
+{
+    template <typename TMsg>
+    static std::size_t get(const TMsg& msg)
+    {
+        using AllFields = typename TMsg::AllFields;
+        return FrameFieldsOp<0U, std::tuple_size<AllFields>::value>::length(msg.fields());
+    }
+};
+
+}  // namespace details
+
+/// @brief Running Fletcher checksum of the serialised frame.
+/// @see ublox::ChecksumWriteIterator
+struct FrameChecksum
+{
+    std::uint8_t m_ckA = 0U; ///< Value of @b CK_A
+    std::uint8_t m_ckB = 0U; ///< Value of @b CK_B
+
+    /// @brief Add single byte to the checksum.
+    void update(std::uint8_t byte)
+    {
+        m_ckA = static_cast<std::uint8_t>(m_ckA + byte);
+        m_ckB = static_cast<std::uint8_t>(m_ckB + m_ckA);
+    }
+};
+
+/// @brief Output iterator adaptor, which accumulates the checksum of
+///     every written byte.
+/// @details Forwards the written bytes to the wrapped output iterator. The
+///     checksum is kept in external @ref FrameChecksum object, so all the copies
+///     of the adaptor update the same checksum.
+/// @tparam TIter Type of the wrapped output iterator.
+template <typename TIter>
+class ChecksumWriteIterator
+{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = std::uint8_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    /// @brief Constructor.
+    /// @param[in] iter Wrapped output iterator.
+    /// @param[in] checksum Checksum to update.
+    ChecksumWriteIterator(TIter iter, FrameChecksum& checksum)
+      : m_iter(iter),
+        m_checksum(&checksum)
+    {
+    }
+
+    /// @brief Write the byte and update the checksum.
+    ChecksumWriteIterator& operator=(std::uint8_t byte)
+    {
+        m_checksum->update(byte);
+        *m_iter = byte;
+        ++m_iter;
+        return *this;
+    }
+
+    /// @brief No-op dereference, required by output iterator concept.
+    ChecksumWriteIterator& operator*()
+    {
+        return *this;
+    }
+
+    /// @brief No-op increment, the wrapped iterator is advanced on write.
+    ChecksumWriteIterator& operator++()
+    {
+        return *this;
+    }
+
+    /// @brief No-op increment, the wrapped iterator is advanced on write.
+    ChecksumWriteIterator& operator++(int)
+    {
+        return *this;
+    }
+
+    /// @brief Get the wrapped iterator.
+    TIter base() const
+    {
+        return m_iter;
+    }
+
+private:
+    TIter m_iter;
+    FrameChecksum* m_checksum = nullptr;
+};
+
+/// @brief Check whether serialisation length of the message payload
+///     is known at compile time.
+/// @tparam TMsg Concrete message type, such as ublox::message::CfgRate<...>.
+template <typename TMsg>
+constexpr bool isFixedLengthMsg()
+{
+    return details::FrameFieldsLength<typename TMsg::AllFields>::Fixed;
+}
+
+/// @brief Get serialisation length of the message payload.
+/// @details Compile time constant for messages, all fields of which have
+///     fixed length. Otherwise it is a sum of the current lengths of all the
+///     fields.
+/// @tparam TMsg Concrete message type, such as ublox::message::CfgRate<...>.
+template <typename TMsg>
+std::size_t payloadLengthOf(const TMsg& msg)
+{
+    return details::FramePayloadLengthCalc<isFixedLengthMsg<TMsg>()>::get(msg);
+}
+
+/// @brief Get full serialisation length of the message frame.
+/// @tparam TMsg Concrete message type, such as ublox::message::CfgRate<...>.
+template <typename TMsg>
+std::size_t frameLengthOf(const TMsg& msg)
+{
+    return payloadLengthOf(msg) + protocol::FrameOverheadLength;
+}
+
+/// @brief Serialise the full frame of the message in a single forward pass.
+/// @details Unlike @b write() of the protocol stack (@ref ublox::Stack),
+///     the checksum is accumulated while serialising, so there is never
+///     @b comms::ErrorStatus::UpdateRequired status that needs a second
+///     pass over the written data. Any output iterator can be used, including
+///     @b std::back_insert_iterator, @b std::ostream_iterator or an iterator
+///     writing directly into the file descriptor. The ID of the message
+///     is known at compile time, and so is the payload length for messages
+///     with fixed layout (see @ref isFixedLengthMsg()).
+/// @code
+/// std::vector<std::uint8_t> buf;
+/// buf.reserve(ublox::frameLengthOf(msg));
+/// auto iter = std::back_inserter(buf);
+/// auto es = ublox::writeFrame(msg, iter, buf.max_size());
+/// @endcode
+/// @tparam TMsg Concrete message type, defined with
+///     @b comms::option::StaticNumIdImpl option, such as ublox::message::CfgRate<...>.
+///     The interface options of the message (such as @b comms::option::WriteIterator)
+///     are irrelevant.
+/// @param[in] msg Message to serialise.
+/// @param[in, out] iter Output iterator, advanced past the written frame.
+/// @param[in] size Maximal number of bytes that can be written.
+/// @return Status of the write operation, @b comms::ErrorStatus::BufferOverflow
+///     when frame doesn't fit into @b size bytes. Nothing is written in such case.
+template <typename TMsg, typename TIter>
+comms::ErrorStatus writeFrame(
+    const TMsg& msg,
+    TIter& iter,
+    std::size_t size = protocol::MaxFrameLength)
+{
+    auto payloadLen = payloadLengthOf(msg);
+    if (protocol::MaxPayloadLength < payloadLen) {
+        return comms::ErrorStatus::InvalidMsgData;
+    }
+
+    if (size < (payloadLen + protocol::FrameOverheadLength)) {
+        return comms::ErrorStatus::BufferOverflow;
+    }
+
+    static const std::uint16_t Id = details::MsgIdOf<TMsg>::Value;
+    static const unsigned ByteBits = std::numeric_limits<std::uint8_t>::digits;
+
+    *iter = protocol::SyncChar1;
+    ++iter;
+    *iter = protocol::SyncChar2;
+    ++iter;
+
+    FrameChecksum checksum;
+    ChecksumWriteIterator<TIter> ckIter(iter, checksum);
+    *ckIter = details::msgIdClass(Id);
+    *ckIter = details::msgIdLow(Id);
+    *ckIter = static_cast<std::uint8_t>(payloadLen);
+    *ckIter = static_cast<std::uint8_t>(payloadLen >> ByteBits);
+
+    using AllFields = typename TMsg::AllFields;
+    auto es =
+        details::FrameFieldsOp<0U, std::tuple_size<AllFields>::value>::write(msg.fields(), ckIter);
+    iter = ckIter.base();
+    if (es != comms::ErrorStatus::Success) {
+        return es;
+    }
+
+    *iter = checksum.m_ckA;
+    ++iter;
+    *iter = checksum.m_ckB;
+    ++iter;
+    return comms::ErrorStatus::Success;
+}
+
+}  // namespace ublox
+
+
@@ -0,0 +1,547 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::InstrumentedStack class and
+///     the statistics it collects.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "protocol/Frame.h"
+#include "protocol/Resync.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+// Relaxed increment, the counters may be updated by multiple threads
+template <typename T>
+void statsAdd(std::atomic<T>& counter, T value)
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+}  // namespace details
+
+template <std::size_t TMaxIds>
+class StackStats;
+
+/// @brief Statistics collected for a single message ID.
+/// @details All the counters are atomic and can be read from any thread.
+///     The decode time histogram has logarithmic buckets with 4 linear
+///     sub-buckets per power of two (similar to HDR histogram with 2 bits of
+///     precision), the values are in nanoseconds.
+class MsgIdStats
+{
+public:
+    /// @brief Number of linear sub-buckets per power of two in the histogram.
+    static const std::size_t SubBuckets = 4U;
+
+    /// @brief Number of buckets in the decode time histogram.
+    /// @details The values exceeding 2^32 ns are counted in the last bucket.
+    static const std::size_t NumOfBuckets = 31U * SubBuckets;
+
+    /// @brief Get index of the histogram bucket for the value.
+    static std::size_t bucketIdx(std::uint64_t value)
+    {
+        if (value < SubBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+
+        if (std::numeric_limits<std::uint32_t>::max() < value) {
+            return NumOfBuckets - 1U;
+        }
+
+        auto exp = highestSetBitIdx(static_cast<std::uint32_t>(value));
+        auto sub = static_cast<std::size_t>(value >> (exp - 2U)) & (SubBuckets - 1U);
+        return ((exp - 1U) * SubBuckets) + sub;
+    }
+
+    /// @brief Get the lowest value (in nanoseconds) that falls into the bucket.
+    static std::uint64_t bucketLowerBound(std::size_t idx)
+    {
+        if (idx < SubBuckets) {
+            return idx;
+        }
+
+        auto exp = (idx / SubBuckets) + 1U;
+        auto sub = idx % SubBuckets;
+        return (std::uint64_t(SubBuckets) + sub) << (exp - 2U);
+    }
+
+    /// @brief Get message ID.
+    MsgId id() const
+    {
+        return static_cast<MsgId>(m_id.load(std::memory_order_acquire));
+    }
+
+    /// @brief Number of successfully read frames.
+    std::uint64_t frames() const
+    {
+        return m_frames.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Total length of successfully read frames.
+    std::uint64_t bytes() const
+    {
+        return m_bytes.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of written frames.
+    std::uint64_t txFrames() const
+    {
+        return m_txFrames.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Total length of written frames.
+    std::uint64_t txBytes() const
+    {
+        return m_txBytes.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of frames with wrong checksum.
+    /// @details Counted only once the ID is tracked, i.e. after a frame with
+    ///     valid checksum has been seen, see also ublox::StackStats::checksumErrors().
+    std::uint64_t checksumErrors() const
+    {
+        return m_checksumErrors.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of frames with valid checksum, but rejected by the message.
+    /// @details Usually caused by unexpected payload length.
+    std::uint64_t lengthErrors() const
+    {
+        return m_lengthErrors.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of decode time samples in the histogram bucket.
+    std::uint64_t decodeTimeCount(std::size_t bucket) const
+    {
+        return m_decodeTime[bucket].load(std::memory_order_relaxed);
+    }
+
+private:
+    template <std::size_t TMaxIds>
+    friend class StackStats;
+
+    static const std::uint32_t NoId = std::numeric_limits<std::uint32_t>::max();
+
+    static std::size_t highestSetBitIdx(std::uint32_t value)
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>(std::numeric_limits<unsigned>::digits - 1 - __builtin_clz(value));
+#else
+        std::size_t idx = 0U;
+        while ((value >>= 1U) != 0U) {
+            ++idx;
+        }
+        return idx;
+#endif
+    }
+
+    std::atomic<std::uint32_t> m_id{NoId};
+    std::atomic<std::uint64_t> m_frames{0U};
+    std::atomic<std::uint64_t> m_bytes{0U};
+    std::atomic<std::uint64_t> m_txFrames{0U};
+    std::atomic<std::uint64_t> m_txBytes{0U};
+    std::atomic<std::uint64_t> m_checksumErrors{0U};
+    std::atomic<std::uint64_t> m_lengthErrors{0U};
+    std::array<std::atomic<std::uint64_t>, NumOfBuckets> m_decodeTime;
+};
+
+/// @brief Statistics of the protocol stack collected by ublox::InstrumentedStack.
+/// @details Up to @b TMaxIds distinct message IDs are tracked individually.
+///     The statistics may be updated by multiple threads (for example the
+///     ones reading and writing using the same protocol stack) and read by
+///     any other thread without any locking. Every counter is updated and read
+///     atomically, the slot of the new message ID is claimed with
+///     compare-and-swap. Consistency between different counters is not guaranteed.
+///     The slots are claimed only by the frames with valid checksum, the
+///     ones with wrong checksum are counted by @ref checksumErrors().
+/// @tparam TMaxIds Maximal number of individually tracked message IDs.
+template <std::size_t TMaxIds = 64U>
+class StackStats
+{
+public:
+    /// @brief Constructor
+    StackStats()
+    {
+        for (auto& elem : m_ids) {
+            for (auto& bucket : elem.m_decodeTime) {
+                bucket.store(0U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Get statistics of the message ID.
+    /// @return Pointer to the statistics, @b nullptr if the ID hasn't been seen yet.
+    const MsgIdStats* find(MsgId id) const
+    {
+        auto idx = static_cast<std::size_t>(id) % TMaxIds;
+        for (auto count = 0U; count < TMaxIds; ++count) {
+            auto& elem = m_ids[idx];
+            auto elemId = elem.m_id.load(std::memory_order_acquire);
+            if (elemId == MsgIdStats::NoId) {
+                break;
+            }
+
+            if (elemId == static_cast<std::uint32_t>(id)) {
+                return &elem;
+            }
+
+            idx = (idx + 1) % TMaxIds;
+        }
+        return nullptr;
+    }
+
+    /// @brief Invoke provided function for statistics of every seen message ID.
+    /// @param[in] func Function with <b>void (const ublox::MsgIdStats&)</b> signature.
+    template <typename TFunc>
+    void forEach(TFunc&& func) const
+    {
+        for (auto& elem : m_ids) {
+            if (elem.m_id.load(std::memory_order_acquire) != MsgIdStats::NoId) {
+                func(elem);
+            }
+        }
+    }
+
+    /// @brief Number of frames with wrong checksum.
+    /// @details The message ID of such frame is unreliable, the error is also
+    ///     counted by ublox::MsgIdStats::checksumErrors() only if the ID is
+    ///     already tracked.
+    std::uint64_t checksumErrors() const
+    {
+        return m_checksumErrors.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of bytes skipped while looking for the next frame.
+    /// @details Calculated assuming the read loop skips to the next
+    ///     synchronisation sequence on protocol error (see ublox::protocol::Resync).
+    std::uint64_t resyncBytes() const
+    {
+        return m_resyncBytes.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of valid frames with message ID unknown to the protocol stack.
+    std::uint64_t unknownIds() const
+    {
+        return m_unknownIds.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of events for the message IDs which aren't tracked individually.
+    std::uint64_t untracked() const
+    {
+        return m_untracked.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Reset all the statistics.
+    /// @details Zeroes all the counters and releases the slots of all the
+    ///     tracked message IDs, so they can be claimed again. The events
+    ///     recorded by other threads during the reset may be lost or partially
+    ///     counted.
+    void reset()
+    {
+        for (auto& elem : m_ids) {
+            elem.m_id.store(MsgIdStats::NoId, std::memory_order_release);
+            elem.m_frames.store(0U, std::memory_order_relaxed);
+            elem.m_bytes.store(0U, std::memory_order_relaxed);
+            elem.m_txFrames.store(0U, std::memory_order_relaxed);
+            elem.m_txBytes.store(0U, std::memory_order_relaxed);
+            elem.m_checksumErrors.store(0U, std::memory_order_relaxed);
+            elem.m_lengthErrors.store(0U, std::memory_order_relaxed);
+            for (auto& bucket : elem.m_decodeTime) {
+                bucket.store(0U, std::memory_order_relaxed);
+            }
+        }
+
+        m_checksumErrors.store(0U, std::memory_order_relaxed);
+        m_resyncBytes.store(0U, std::memory_order_relaxed);
+        m_unknownIds.store(0U, std::memory_order_relaxed);
+        m_untracked.store(0U, std::memory_order_relaxed);
+    }
+
+    /// @cond INTERNAL
+    MsgIdStats* record(MsgId id)
+    {
+        auto idx = static_cast<std::size_t>(id) % TMaxIds;
+        for (auto count = 0U; count < TMaxIds; ++count) {
+            auto& elem = m_ids[idx];
+            auto elemId = elem.m_id.load(std::memory_order_acquire);
+            if (elemId == MsgIdStats::NoId) {
+                // Another thread may claim the slot at the same time
+                elemId = MsgIdStats::NoId;
+                if (elem.m_id.compare_exchange_strong(
+                        elemId, static_cast<std::uint32_t>(id),
+                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return &elem;
+                }
+            }
+
+            if (elemId == static_cast<std::uint32_t>(id)) {
+                return &elem;
+            }
+
+            idx = (idx + 1) % TMaxIds;
+        }
+
+        details::statsAdd(m_untracked, std::uint64_t(1U));
+        return nullptr;
+    }
+
+    void recordRead(MsgId id, std::size_t len, std::uint64_t decodeNs)
+    {
+        auto* elem = record(id);
+        if (elem != nullptr) {
+            details::statsAdd(elem->m_frames, std::uint64_t(1U));
+            details::statsAdd(elem->m_bytes, static_cast<std::uint64_t>(len));
+            details::statsAdd(elem->m_decodeTime[MsgIdStats::bucketIdx(decodeNs)], std::uint64_t(1U));
+        }
+    }
+
+    void recordWrite(MsgId id, std::size_t len)
+    {
+        auto* elem = record(id);
+        if (elem != nullptr) {
+            details::statsAdd(elem->m_txFrames, std::uint64_t(1U));
+            details::statsAdd(elem->m_txBytes, static_cast<std::uint64_t>(len));
+        }
+    }
+
+    void recordChecksumError(MsgId id)
+    {
+        details::statsAdd(m_checksumErrors, std::uint64_t(1U));
+
+        // Don't claim the slot for the ID from the corrupted frame
+        auto* elem = const_cast<MsgIdStats*>(find(id));
+        if (elem != nullptr) {
+            details::statsAdd(elem->m_checksumErrors, std::uint64_t(1U));
+        }
+    }
+
+    void recordLengthError(MsgId id)
+    {
+        auto* elem = record(id);
+        if (elem != nullptr) {
+            details::statsAdd(elem->m_lengthErrors, std::uint64_t(1U));
+        }
+    }
+
+    void recordResync(std::size_t len)
+    {
+        details::statsAdd(m_resyncBytes, static_cast<std::uint64_t>(len));
+    }
+
+    void recordUnknownId()
+    {
+        details::statsAdd(m_unknownIds, std::uint64_t(1U));
+    }
+    /// @endcond
+
+private:
+    std::array<MsgIdStats, TMaxIds> m_ids;
+    std::atomic<std::uint64_t> m_checksumErrors{0U};
+    std::atomic<std::uint64_t> m_resyncBytes{0U};
+    std::atomic<std::uint64_t> m_unknownIds{0U};
+    std::atomic<std::uint64_t> m_untracked{0U};
+};
+
+/// @brief Protocol stack collecting statistics per message ID.
+/// @details Wraps any variant of the protocol stack (ublox::Stack,
+///     ublox::TableStack, ublox::FilteredStack, etc...) and records
+///     number and length of read and written frames, checksum and length
+///     errors, skipped bytes and histogram of the decode time (see
+///     ublox::StackStats). The statistics are collected only when reading
+///     from <b>const std::uint8_t*</b> iterator.
+///     @code
+///     using ProtStack = ublox::InstrumentedStack<ublox::Stack<MyInputMessage, MyInputMessages> >;
+///
+///     // In the other thread
+///     protStack.stats().forEach(
+///         [](const ublox::MsgIdStats& stats)
+///         {
+///             exportCounter(stats.id(), stats.frames());
+///         });
+///     @endcode
+///     When @b TEnabled is @b false the class is the wrapped stack itself
+///     with no extra members and no overhead, the @b stats() member function
+///     is not available.
+/// @tparam TStack Type of the wrapped protocol stack.
+/// @tparam TEnabled Enable collection of the statistics.
+/// @tparam TMaxIds Maximal number of individually tracked message IDs.
+template <typename TStack, bool TEnabled = true, std::size_t TMaxIds = 64U>
+class InstrumentedStack : public TStack
+{
+    using Base = TStack;
+
+public:
+    /// @brief Type of smart pointer holding allocated message object.
+    using MsgPtr = typename Base::MsgPtr;
+
+    /// @brief Type of the collected statistics.
+    using Stats = StackStats<TMaxIds>;
+
+    /// @brief Access the collected statistics.
+    const Stats& stats() const
+    {
+        return m_stats;
+    }
+
+    /// @brief Reset the collected statistics, see ublox::StackStats::reset().
+    void resetStats()
+    {
+        m_stats.reset();
+    }
+
+    /// @brief Deserialise message from the input data sequence.
+    /// @details Has the same semantics as @b read() member function of the
+    ///     wrapped stack.
+    template <typename TIter>
+    comms::ErrorStatus read(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<TIter, const std::uint8_t*>::value,
+                StatsTag,
+                BaseTag
+            >::type;
+        return readInternal(msgPtr, iter, size, missingSize, Tag());
+    }
+
+    /// @brief Serialise message into the output data sequence.
+    /// @details Has the same semantics as @b write() member function of the
+    ///     wrapped stack.
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus write(const TMsg& msg, TIter& iter, std::size_t size) const
+    {
+        auto es = Base::write(msg, iter, size);
+        if ((es == comms::ErrorStatus::Success) ||
+            (es == comms::ErrorStatus::UpdateRequired)) {
+            m_stats.recordWrite(msg.getId(), Base::length(msg));
+        }
+        return es;
+    }
+
+private:
+    struct StatsTag {};
+    struct BaseTag {};
+    using Clock = std::chrono::steady_clock;
+
+    template <typename TIter>
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        BaseTag)
+    {
+        return Base::read(msgPtr, iter, size, missingSize);
+    }
+
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        const std::uint8_t*& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        StatsTag)
+    {
+        auto* frame = iter;
+        auto start = Clock::now();
+        auto es = Base::read(msgPtr, iter, size, missingSize);
+        auto end = Clock::now();
+
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            return es;
+        }
+
+        bool headerValid =
+            (protocol::FrameHeaderLength <= size) &&
+            (frame[0] == protocol::SyncChar1) &&
+            (frame[1] == protocol::SyncChar2);
+
+        if ((es == comms::ErrorStatus::ProtocolError) &&
+            headerValid &&
+            (protocol::checkFrame(frame, size) == comms::ErrorStatus::Success)) {
+            // Valid frame with payload too short for the message type
+            m_stats.recordLengthError(protocol::frameMsgId(frame));
+            return es;
+        }
+
+        if (es == comms::ErrorStatus::ProtocolError) {
+            if (headerValid) {
+                m_stats.recordChecksumError(protocol::frameMsgId(frame));
+            }
+
+            auto* next = protocol::findSync(frame + 1, frame + size);
+            m_stats.recordResync(static_cast<std::size_t>(next - frame));
+            return es;
+        }
+
+        if (!headerValid) {
+            return es;
+        }
+
+        auto id = protocol::frameMsgId(frame);
+        if (es == comms::ErrorStatus::InvalidMsgId) {
+            m_stats.recordUnknownId();
+            return es;
+        }
+
+        if (es == comms::ErrorStatus::InvalidMsgData) {
+            m_stats.recordLengthError(id);
+            return es;
+        }
+
+        if (es == comms::ErrorStatus::Success) {
+            auto decodeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            m_stats.recordRead(
+                id,
+                protocol::frameLength(frame),
+                static_cast<std::uint64_t>(decodeNs));
+        }
+        return es;
+    }
+
+    mutable Stats m_stats;
+};
+
+/// @brief Disabled instrumentation, same as the wrapped stack.
+template <typename TStack, std::size_t TMaxIds>
+class InstrumentedStack<TStack, false, TMaxIds> : public TStack
+{
+};
+
+}  // namespace ublox
+
+
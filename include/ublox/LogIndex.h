@@ -0,0 +1,402 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::LogIndex class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "MsgId.h"
+#include "FrameSplitter.h"
+#include "NavTime.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+/// @brief Single entry of ublox::LogIndex.
+struct LogIndexEntry
+{
+    std::uint64_t m_offset = 0U; ///< Offset of the frame in the log
+    MsgId m_id = MsgId(); ///< ID of the message
+    std::uint16_t m_week = 0U; ///< Last known GPS week, @ref ublox::LogIndex::UnknownWeek if none
+    std::uint32_t m_iTOW = 0U; ///< Last known GPS time of week in ms, @ref ublox::LogIndex::UnknownTow if none
+};
+
+/// @brief Index of the frames in the log of raw UBX data.
+/// @details Holds an entry (ublox::LogIndexEntry) for every valid frame in the log
+///     with its offset, message ID, and GPS time (week and time of week) of the
+///     navigation epoch the frame belongs to. The time is tracked by
+///     ublox::NavTimeTracker: the time of week is taken from the @b iTOW field
+///     of the @b NAV class messages that report it, while the week is
+///     taken from @b NAV-TIMEGPS, @b NAV-SOL or the date of @b NAV-PVT and
+///     is incremented when the time of week wraps around. Until the week is
+///     known, the times are compared as if it were 0. In addition, sparse time
+///     checkpoints (one per navigation epoch) and the list of entries per
+///     message ID are maintained, which allows finding the frames by time
+///     (see @ref findTime()) and by message ID (see @ref findNext()) in
+///     logarithmic time.
+///
+///     The index can be saved to and loaded from the compact sidecar file (see
+///     @ref save(), @ref load(), @ref sidecarPath()). When the log has only
+///     grown since the index was built, @ref update() indexes only the new data.
+///     @code
+///     ublox::MappedLog log(path);
+///     ublox::LogIndex index;
+///     auto idxPath = ublox::LogIndex::sidecarPath(path);
+///     index.load(idxPath); // May fail if doesn't exist
+///     index.update(log.data(), log.size());
+///     index.save(idxPath);
+///     auto entryIdx = index.findTime(week, iTOW);
+///     if (entryIdx < index.size()) {
+///         auto iter = log.seek(index.entries()[entryIdx].m_offset);
+///         ...
+///     }
+///     @endcode
+class LogIndex
+{
+public:
+    /// @brief Value of unknown week.
+    static const std::uint16_t UnknownWeek = NavTimeTracker::UnknownWeek;
+
+    /// @brief Value of unknown time of week.
+    static const std::uint32_t UnknownTow = NavTimeTracker::UnknownTow;
+
+    /// @brief Type of the entries list.
+    using Entries = std::vector<LogIndexEntry>;
+
+    /// @brief Get default path of the sidecar file for the log.
+    static std::string sidecarPath(const std::string& logPath)
+    {
+        return logPath + ".idx";
+    }
+
+    /// @brief Get all the entries.
+    const Entries& entries() const
+    {
+        return m_entries;
+    }
+
+    /// @brief Get number of the entries.
+    std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    /// @brief Get number of the indexed bytes of the log.
+    /// @details The incomplete frame at the end of the log is not indexed.
+    std::uint64_t indexedLength() const
+    {
+        return m_indexed;
+    }
+
+    /// @brief Discard all the entries.
+    void clear()
+    {
+        m_entries.clear();
+        m_checkpoints.clear();
+        m_ids.clear();
+        m_indexed = 0U;
+        m_lastChecksum = 0U;
+    }
+
+    /// @brief Bring the index up to date with the log contents.
+    /// @details If the log still contains the previously indexed data
+    ///     (i.e. it has only grown), only the new data is indexed. Otherwise
+    ///     the index is rebuilt.
+    /// @param[in] data Contents of the log (see ublox::MappedLog).
+    /// @param[in] size Size of the log.
+    /// @return Number of added entries.
+    std::size_t update(const std::uint8_t* data, std::size_t size)
+    {
+        if (!matches(data, size)) {
+            clear();
+        }
+
+        auto prevSize = m_entries.size();
+        NavTimeTracker time;
+        if (!m_entries.empty()) {
+            time = NavTimeTracker(m_entries.back().m_week, m_entries.back().m_iTOW);
+        }
+
+        auto from = static_cast<std::size_t>(m_indexed);
+        FrameSplitter splitter;
+        auto processed =
+            splitter.forEach(
+                data + from, size - from,
+                [this, data, from, &time](const FrameInfo& info)
+                {
+                    auto* frame = data + from + info.m_offset;
+                    time.update(info.m_id, frame + protocol::FrameHeaderLength, info.m_payloadLen);
+
+                    LogIndexEntry entry;
+                    entry.m_offset = static_cast<std::uint64_t>(from + info.m_offset);
+                    entry.m_id = info.m_id;
+                    entry.m_week = time.week();
+                    entry.m_iTOW = time.iTOW();
+                    add(entry);
+                    m_lastChecksum = readU16(frame + info.length() - protocol::FrameChecksumLength);
+                });
+
+        m_indexed = static_cast<std::uint64_t>(from + processed);
+        return m_entries.size() - prevSize;
+    }
+
+    /// @brief Find the first entry with the time equal or greater than specified.
+    /// @return Index of the entry, @ref size() if not found.
+    std::size_t findTime(std::uint16_t week, std::uint32_t iTOW) const
+    {
+        auto time = NavTimeTracker::timeMs(week, iTOW);
+        auto iter =
+            std::lower_bound(
+                m_checkpoints.begin(), m_checkpoints.end(), time,
+                [](const Checkpoint& checkpoint, std::uint64_t value)
+                {
+                    return checkpoint.m_time < value;
+                });
+
+        if (iter == m_checkpoints.end()) {
+            return m_entries.size();
+        }
+        return iter->m_entryIdx;
+    }
+
+    /// @brief Find the first entry with specified ID at or after specified entry.
+    /// @param[in] id ID of the message.
+    /// @param[in] from Index of the entry to start from.
+    /// @return Index of the entry, @ref size() if not found.
+    std::size_t findNext(MsgId id, std::size_t from = 0U) const
+    {
+        auto idsIter = m_ids.find(id);
+        if (idsIter == m_ids.end()) {
+            return m_entries.size();
+        }
+
+        auto& indices = idsIter->second;
+        auto iter = std::lower_bound(indices.begin(), indices.end(), from);
+        if (iter == indices.end()) {
+            return m_entries.size();
+        }
+        return *iter;
+    }
+
+    /// @brief Find the first entry with specified ID and with the time equal
+    ///     or greater than specified.
+    /// @return Index of the entry, @ref size() if not found.
+    std::size_t findTime(MsgId id, std::uint16_t week, std::uint32_t iTOW) const
+    {
+        return findNext(id, findTime(week, iTOW));
+    }
+
+    /// @brief Save the index to file.
+    /// @return @b true on success.
+    bool save(const std::string& path) const
+    {
+        auto* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        std::vector<std::uint8_t> buf;
+        buf.reserve(HeaderLength + (m_entries.size() * EntryLength));
+        buf.insert(buf.end(), magic(), magic() + MagicLength);
+        writeUint(buf, Version, 4U);
+        writeUint(buf, m_indexed, 8U);
+        writeUint(buf, m_lastChecksum, 2U);
+        writeUint(buf, 0U, 2U); // reserved
+        writeUint(buf, m_entries.size(), 8U);
+        for (auto& entry : m_entries) {
+            writeUint(buf, entry.m_offset, 8U);
+            writeUint(buf, static_cast<std::uint16_t>(entry.m_id), 2U);
+            writeUint(buf, entry.m_week, 2U);
+            writeUint(buf, entry.m_iTOW, 4U);
+        }
+
+        auto written = std::fwrite(buf.data(), 1U, buf.size(), file);
+        auto closed = (std::fclose(file) == 0);
+        return closed && (written == buf.size());
+    }
+
+    /// @brief Load the index from file.
+    /// @details The index is cleared on failure.
+    /// @return @b true on success.
+    bool load(const std::string& path)
+    {
+        clear();
+        auto* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        auto result = loadFrom(file);
+        std::fclose(file);
+        if (!result) {
+            clear();
+        }
+        return result;
+    }
+
+private:
+    struct Checkpoint
+    {
+        std::uint64_t m_time;
+        std::size_t m_entryIdx;
+    };
+
+    static const std::uint32_t Version = 2U;
+    static const std::size_t HeaderLength = 32U;
+    static const std::size_t EntryLength = 16U;
+    static const std::size_t MagicLength = 8U;
+
+    static const std::uint8_t* magic()
+    {
+        static const std::uint8_t Magic[MagicLength] = {'U', 'B', 'X', 'I', 'D', 'X', 0U, 0U};
+        return &Magic[0];
+    }
+
+    static std::uint16_t readU16(const std::uint8_t* data)
+    {
+        return static_cast<std::uint16_t>(data[0] | (static_cast<unsigned>(data[1]) << 8U));
+    }
+
+    static std::uint64_t readUint(const std::uint8_t* data, std::size_t len)
+    {
+        std::uint64_t value = 0U;
+        for (auto idx = len; 0U < idx; --idx) {
+            value = (value << 8U) | data[idx - 1];
+        }
+        return value;
+    }
+
+    static void writeUint(std::vector<std::uint8_t>& buf, std::uint64_t value, std::size_t len)
+    {
+        for (auto idx = 0U; idx < len; ++idx) {
+            buf.push_back(static_cast<std::uint8_t>(value >> (idx * 8U)));
+        }
+    }
+
+    void add(const LogIndexEntry& entry)
+    {
+        auto entryIdx = m_entries.size();
+        m_entries.push_back(entry);
+        m_ids[entry.m_id].push_back(entryIdx);
+        if (entry.m_iTOW == UnknownTow) {
+            return;
+        }
+
+        // Only increasing times are recorded to keep checkpoints sorted
+        auto time = NavTimeTracker::timeMs(entry.m_week, entry.m_iTOW);
+        if ((!m_checkpoints.empty()) && (time <= m_checkpoints.back().m_time)) {
+            return;
+        }
+
+        m_checkpoints.push_back(Checkpoint{time, entryIdx});
+    }
+
+    bool matches(const std::uint8_t* data, std::size_t size) const
+    {
+        if (size < m_indexed) {
+            return false;
+        }
+
+        if (m_entries.empty()) {
+            return m_indexed == 0U;
+        }
+
+        auto& last = m_entries.back();
+        auto offset = static_cast<std::size_t>(last.m_offset);
+        if (m_indexed <= offset) {
+            return false;
+        }
+
+        auto* frame = data + offset;
+        auto remLen = static_cast<std::size_t>(m_indexed) - offset;
+        if ((protocol::checkFrame(frame, remLen) != comms::ErrorStatus::Success) ||
+            (protocol::frameMsgId(frame) != last.m_id)) {
+            return false;
+        }
+
+        auto frameLen = protocol::frameLength(frame);
+        return readU16(frame + frameLen - protocol::FrameChecksumLength) == m_lastChecksum;
+    }
+
+    bool loadFrom(std::FILE* file)
+    {
+        std::uint8_t header[HeaderLength];
+        if (std::fread(header, 1U, HeaderLength, file) != HeaderLength) {
+            return false;
+        }
+
+        if ((!std::equal(magic(), magic() + MagicLength, &header[0])) ||
+            (readUint(&header[8], 4U) != Version)) {
+            return false;
+        }
+
+        auto indexed = readUint(&header[12], 8U);
+        auto lastChecksum = static_cast<std::uint16_t>(readUint(&header[20], 2U));
+        auto count = readUint(&header[24], 8U);
+        if ((std::numeric_limits<std::size_t>::max() / EntryLength) < count) {
+            return false;
+        }
+
+        std::vector<std::uint8_t> buf(static_cast<std::size_t>(count) * EntryLength);
+        if (std::fread(buf.data(), 1U, buf.size(), file) != buf.size()) {
+            return false;
+        }
+
+        m_entries.reserve(static_cast<std::size_t>(count));
+        for (auto* data = buf.data(); data < (buf.data() + buf.size()); data += EntryLength) {
+            LogIndexEntry entry;
+            entry.m_offset = readUint(data, 8U);
+            entry.m_id = static_cast<MsgId>(readU16(data + 8));
+            entry.m_week = readU16(data + 10);
+            entry.m_iTOW = static_cast<std::uint32_t>(readUint(data + 12, 4U));
+            if ((!m_entries.empty()) && (entry.m_offset <= m_entries.back().m_offset)) {
+                return false;
+            }
+            add(entry);
+        }
+
+        if ((!m_entries.empty()) && (indexed <= m_entries.back().m_offset)) {
+            return false;
+        }
+
+        m_indexed = indexed;
+        m_lastChecksum = lastChecksum;
+        return true;
+    }
+
+    Entries m_entries;
+    std::vector<Checkpoint> m_checkpoints;
+    std::map<MsgId, std::vector<std::size_t> > m_ids;
+    std::uint64_t m_indexed = 0U;
+    std::uint16_t m_lastChecksum = 0U;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,445 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::MappedLog class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "FrameSplitter.h"
+#include "protocol/Frame.h"
+#include "protocol/Resync.h"
+
+#if defined(_WIN32)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ublox
+{
+
+/// @brief Read-only memory mapped log of raw UBX data.
+/// @details Maps the whole file (such as @b .ubx capture of the receiver output)
+///     into memory and walks the valid frames in place, i.e. the data is never
+///     copied. The frames can be iterated (see @ref begin(), @ref end()),
+///     filtered by ID (see @ref forEach()), read by the protocol stack
+///     (see @ref readMessages()) or accessed by offset (see @ref seek()). Bytes
+///     between the valid frames (including the frames of other protocols and
+///     truncated last frame) are skipped.
+///     @code
+///     ublox::MappedLog log("capture.ubx");
+///     for (auto& info : log) {
+///         auto* frame = log.frame(info);
+///         ...
+///     }
+///     @endcode
+class MappedLog
+{
+public:
+    /// @brief Forward iterator over the valid frames of the log.
+    class FrameIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FrameInfo;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const FrameInfo*;
+        using reference = const FrameInfo&;
+
+        /// @brief Default constructor, creates end iterator of empty log.
+        FrameIterator() = default;
+
+        /// @brief Access the information about current frame.
+        reference operator*() const
+        {
+            return m_info;
+        }
+
+        /// @brief Access the information about current frame.
+        pointer operator->() const
+        {
+            return &m_info;
+        }
+
+        /// @brief Advance to the next valid frame.
+        FrameIterator& operator++()
+        {
+            find(m_info.m_offset + m_info.length());
+            return *this;
+        }
+
+        /// @brief Advance to the next valid frame (postfix).
+        FrameIterator operator++(int)
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        /// @brief Equality comparison.
+        bool operator==(const FrameIterator& other) const
+        {
+            return (m_data == other.m_data) && (m_info.m_offset == other.m_info.m_offset);
+        }
+
+        /// @brief Inequality comparison.
+        bool operator!=(const FrameIterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class MappedLog;
+
+        FrameIterator(const std::uint8_t* data, std::size_t size, std::size_t offset)
+          : m_data(data),
+            m_size(size)
+        {
+            find(offset);
+        }
+
+        void find(std::size_t offset)
+        {
+            auto* end = m_data + m_size;
+            auto* iter = m_data + std::min(offset, m_size);
+            while (true) {
+                iter = protocol::findSync(iter, end);
+                if (iter == end) {
+                    break;
+                }
+
+                auto remLen = static_cast<std::size_t>(end - iter);
+                if (protocol::checkFrame(iter, remLen) == comms::ErrorStatus::Success) {
+                    break;
+                }
+                ++iter;
+            }
+
+            m_info = FrameInfo();
+            m_info.m_offset = static_cast<std::size_t>(iter - m_data);
+            if (iter != end) {
+                m_info.m_id = protocol::frameMsgId(iter);
+                m_info.m_payloadLen = static_cast<std::uint16_t>(protocol::framePayloadLength(iter));
+            }
+        }
+
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0U;
+        FrameInfo m_info;
+    };
+
+    /// @brief Default constructor, no file is mapped.
+    MappedLog() = default;
+
+    /// @brief Constructor, maps the file.
+    /// @details Use @ref isOpen() to check the success.
+    explicit MappedLog(const std::string& path)
+    {
+        open(path);
+    }
+
+    /// @brief Destructor, unmaps the file.
+    ~MappedLog()
+    {
+        close();
+    }
+
+    MappedLog(const MappedLog&) = delete;
+    MappedLog& operator=(const MappedLog&) = delete;
+
+    /// @brief Move constructor.
+    MappedLog(MappedLog&& other)
+    {
+        swap(other);
+    }
+
+    /// @brief Move assignment.
+    MappedLog& operator=(MappedLog&& other)
+    {
+        if (this != &other) {
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// @brief Map the file.
+    /// @details Previously mapped file is unmapped.
+    /// @return @b true on success.
+    bool open(const std::string& path)
+    {
+        close();
+        m_open = map(path);
+        return m_open;
+    }
+
+    /// @brief Unmap the file.
+    void close()
+    {
+        unmap();
+        m_data = nullptr;
+        m_size = 0U;
+        m_open = false;
+    }
+
+    /// @brief Check whether the file is mapped.
+    bool isOpen() const
+    {
+        return m_open;
+    }
+
+    /// @brief Get pointer to the mapped data.
+    const std::uint8_t* data() const
+    {
+        return m_data;
+    }
+
+    /// @brief Get size of the mapped file.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @brief Get iterator to the first valid frame.
+    FrameIterator begin() const
+    {
+        return FrameIterator(m_data, m_size, 0U);
+    }
+
+    /// @brief Get end iterator.
+    FrameIterator end() const
+    {
+        return FrameIterator(m_data, m_size, m_size);
+    }
+
+    /// @brief Get iterator to the first valid frame starting at or after
+    ///     the specified offset.
+    FrameIterator seek(std::size_t offset) const
+    {
+        return FrameIterator(m_data, m_size, offset);
+    }
+
+    /// @brief Get pointer to the first synchronisation byte of the frame.
+    const std::uint8_t* frame(const FrameInfo& info) const
+    {
+        return m_data + info.m_offset;
+    }
+
+    /// @brief Get pointer to the payload of the frame.
+    const std::uint8_t* payload(const FrameInfo& info) const
+    {
+        return m_data + info.m_offset + protocol::FrameHeaderLength;
+    }
+
+    /// @brief Invoke provided function for every valid frame.
+    /// @param[in] func Function with <b>void (const ublox::FrameInfo&)</b> signature.
+    /// @param[in] from Offset to start from.
+    /// @return Number of found frames.
+    template <typename TFunc>
+    std::size_t forEach(TFunc&& func, std::size_t from = 0U) const
+    {
+        std::size_t count = 0U;
+        for (auto iter = seek(from); iter != end(); ++iter) {
+            func(*iter);
+            ++count;
+        }
+        return count;
+    }
+
+    /// @brief Invoke provided function for every valid frame with specified ID.
+    /// @param[in] id ID of the message.
+    /// @param[in] func Function with <b>void (const ublox::FrameInfo&)</b> signature.
+    /// @param[in] from Offset to start from.
+    /// @return Number of found frames with specified ID.
+    template <typename TFunc>
+    std::size_t forEach(MsgId id, TFunc&& func, std::size_t from = 0U) const
+    {
+        std::size_t count = 0U;
+        for (auto iter = seek(from); iter != end(); ++iter) {
+            if (iter->m_id == id) {
+                func(*iter);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// @brief Read every valid frame using the protocol stack and dispatch
+    ///     the messages to the handler.
+    /// @details The stack reads the mapped data in place. The frames, which
+    ///     fail to be read (for example due to unknown ID) are skipped.
+    /// @tparam TStack Protocol stack type, expected to be some variant of @ref ublox::Stack.
+    ///     The interface class of the input messages must use <b>const std::uint8_t*</b>
+    ///     as its read iterator.
+    /// @param[in] stack Protocol stack.
+    /// @param[in] handler Handler object.
+    /// @param[in] from Offset to start from.
+    /// @return Number of dispatched messages.
+    template <typename TStack, typename THandler>
+    std::size_t readMessages(TStack& stack, THandler& handler, std::size_t from = 0U) const
+    {
+        using MsgPtr = typename TStack::MsgPtr;
+        using MsgType = typename MsgPtr::element_type;
+
+        std::size_t count = 0U;
+        for (auto iter = seek(from); iter != end(); ++iter) {
+            MsgPtr msgPtr;
+            auto readIter = comms::readIteratorFor<MsgType>(frame(*iter));
+            auto es = stack.read(msgPtr, readIter, iter->length());
+            if (es == comms::ErrorStatus::Success) {
+                GASSERT(msgPtr);
+                msgPtr->dispatch(handler);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+private:
+    void swap(MappedLog& other)
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_open, other.m_open);
+#if defined(_WIN32)
+        std::swap(m_file, other.m_file);
+        std::swap(m_mapping, other.m_mapping);
+#endif
+    }
+
+#if defined(_WIN32)
+    bool map(const std::string& path)
+    {
+        m_file = ::CreateFileA(
+            path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (::GetFileSizeEx(m_file, &fileSize) == 0) {
+            return false;
+        }
+
+        if (fileSize.QuadPart == 0) {
+            return true;
+        }
+
+        m_mapping = ::CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping == nullptr) {
+            return false;
+        }
+
+        auto* mapped = ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (mapped == nullptr) {
+            return false;
+        }
+
+        m_data = static_cast<const std::uint8_t*>(mapped);
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void unmap()
+    {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+
+        if (m_mapping != nullptr) {
+            ::CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+
+        if (m_file != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+    }
+
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    bool map(const std::string& path)
+    {
+        auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        auto fileSize = static_cast<std::size_t>(info.st_size);
+        if (fileSize == 0U) {
+            ::close(fd);
+            return true;
+        }
+
+        auto* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping remains valid
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        ::madvise(mapped, fileSize, MADV_SEQUENTIAL);
+        m_data = static_cast<const std::uint8_t*>(mapped);
+        m_size = fileSize;
+        return true;
+    }
+
+    void unmap()
+    {
+        if (m_data != nullptr) {
+            ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+        }
+    }
+#endif
+
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0U;
+    bool m_open = false;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,411 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::MessagePool and ublox::PooledMessage classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "FrameWriter.h"
+
+namespace ublox
+{
+
+/// @brief Pool of the memory blocks for message objects of a single type.
+/// @details Fixed number of the blocks, each suitable for the object of
+///     @b TMsg type, is kept in static storage. The free blocks are linked into
+///     lock-free stack, the head of which is tagged with the modification count to
+///     prevent the ABA problem. As the result the blocks can be allocated and
+///     released by different threads (see ublox::DecodePipeline). When all
+///     the blocks are in use the memory is allocated on the heap (counted
+///     as a miss).
+/// @tparam TMsg Type of the message object.
+/// @tparam TCapacity Number of the blocks in the pool.
+template <typename TMsg, std::size_t TCapacity>
+class MessagePool
+{
+    static_assert(0U < TCapacity, "Capacity mustn't be 0");
+    static_assert(TCapacity < std::numeric_limits<std::uint32_t>::max(), "Capacity is too big");
+
+public:
+    /// @brief Access the pool instance.
+    /// @details The pool is allocated on the first access and intentionally
+    ///     never destructed, so the messages can be released during
+    ///     static destruction.
+    static MessagePool& instance()
+    {
+        static MessagePool* Pool = new MessagePool;
+        return *Pool;
+    }
+
+    /// @brief Get number of the blocks in the pool.
+    static constexpr std::size_t capacity()
+    {
+        return TCapacity;
+    }
+
+    /// @brief Allocate memory for the message object.
+    /// @param[in] size Requested size, the heap is used if it
+    ///     doesn't match the size of @b TMsg.
+    void* allocate(std::size_t size)
+    {
+        if (size == sizeof(TMsg)) {
+            auto head = m_head.load(std::memory_order_acquire);
+            while (true) {
+                auto idx = static_cast<std::uint32_t>(head);
+                if (idx == Empty) {
+                    break;
+                }
+
+                auto newHead = nextHead(head, m_next[idx].load(std::memory_order_relaxed));
+                if (m_head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+                    m_hits.fetch_add(1U, std::memory_order_relaxed);
+                    return &m_blocks[idx];
+                }
+            }
+        }
+
+        m_misses.fetch_add(1U, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    /// @brief Release memory previously returned by @ref allocate().
+    void deallocate(void* ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        auto idx = static_cast<std::uint32_t>(indexOf(ptr));
+        if (idx == TCapacity) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        auto head = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            m_next[idx].store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+            if (m_head.compare_exchange_weak(head, nextHead(head, idx), std::memory_order_release, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    /// @brief Get index of the block containing the object.
+    /// @return @ref capacity() if the object doesn't reside in the pool.
+    std::size_t indexOf(const void* ptr) const
+    {
+        auto* block = static_cast<const Block*>(ptr);
+        std::less<const Block*> less;
+        if (less(block, &m_blocks[0]) || (!less(block, &m_blocks[TCapacity]))) {
+            return TCapacity;
+        }
+
+        return static_cast<std::size_t>(block - &m_blocks[0]);
+    }
+
+    /// @brief Get number of allocations served by the pool.
+    std::uint64_t hits() const
+    {
+        return m_hits.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Get number of allocations that used the heap.
+    std::uint64_t misses() const
+    {
+        return m_misses.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Reset hit / miss counters.
+    void resetStats()
+    {
+        m_hits.store(0U, std::memory_order_relaxed);
+        m_misses.store(0U, std::memory_order_relaxed);
+    }
+
+private:
+    using Block = typename std::aligned_storage<sizeof(TMsg), alignof(TMsg)>::type;
+
+    static const std::uint32_t Empty = std::numeric_limits<std::uint32_t>::max();
+    static const unsigned TagShift = std::numeric_limits<std::uint32_t>::digits;
+
+    MessagePool()
+    {
+        for (auto idx = 0U; idx < TCapacity; ++idx) {
+            auto next = idx + 1U;
+            if (next == TCapacity) {
+                next = Empty;
+            }
+            m_next[idx].store(static_cast<std::uint32_t>(next), std::memory_order_relaxed);
+        }
+        m_head.store(0U, std::memory_order_release);
+    }
+
+    static std::uint64_t nextHead(std::uint64_t head, std::uint32_t idx)
+    {
+        auto tag = (head >> TagShift) + 1U;
+        return (tag << TagShift) | idx;
+    }
+
+    Block m_blocks[TCapacity];
+    std::atomic<std::uint32_t> m_next[TCapacity];
+    std::atomic<std::uint64_t> m_head;
+    std::atomic<std::uint64_t> m_hits{0U};
+    std::atomic<std::uint64_t> m_misses{0U};
+};
+
+namespace details
+{
+
+template <bool TRetain>
+struct PooledFieldsKeeper;
+
+template <>
+struct PooledFieldsKeeper<false>
+{
+    template <std::size_t TCapacity, typename TMsg>
+    static void restore(TMsg&, std::size_t)
+    {
+    }
+
+    template <std::size_t TCapacity, typename TMsg>
+    static void retain(TMsg&, std::size_t)
+    {
+    }
+};
+
+template <>
+struct PooledFieldsKeeper<true>
+{
+    template <std::size_t TCapacity, typename TMsg>
+    static void restore(TMsg& msg, std::size_t idx)
+    {
+        if (idx < TCapacity) {
+            std::swap(msg.fields(), retained<TMsg, TCapacity>()[idx]);
+        }
+    }
+
+    template <std::size_t TCapacity, typename TMsg>
+    static void retain(TMsg& msg, std::size_t idx)
+    {
+        if (idx < TCapacity) {
+            // Copy assignment keeps the capacity of the list fields
+            msg.fields() = prototype<TMsg>().fields();
+            std::swap(msg.fields(), retained<TMsg, TCapacity>()[idx]);
+        }
+    }
+
+private:
+    // Default constructed message, intentionally never destructed
+    template <typename TMsg>
+    static const TMsg& prototype()
+    {
+        static const TMsg* Msg = new TMsg;
+        return *Msg;
+    }
+
+    // Fields retained per pool block, intentionally never destructed
+    template <typename TMsg, std::size_t TCapacity>
+    static typename TMsg::AllFields* retained()
+    {
+        using AllFields = typename TMsg::AllFields;
+        static AllFields* Storage =
+            []() -> AllFields*
+            {
+                auto* storage = new AllFields[TCapacity];
+                for (auto idx = 0U; idx < TCapacity; ++idx) {
+                    storage[idx] = prototype<TMsg>().fields();
+                }
+                return storage;
+            }();
+        return Storage;
+    }
+};
+
+}  // namespace details
+
+/// @brief Message type allocated from the pool.
+/// @details Extends the message class with class specific @b operator new
+///     and @b operator delete, which use ublox::MessagePool. As the message
+///     interface has virtual destructor, the message object is returned to
+///     the pool when the smart pointer (@b MsgPtr) to the interface class
+///     created by the protocol stack is reset. No modification of the protocol
+///     stack is required, just list pooled message types in the input messages
+///     tuple (see @ref ublox::PooledMessages).
+///     The message handler keeps handling the original message type.
+///
+///     For the messages with variable length (such as ones containing lists)
+///     the fields of the released object are reset to their default values in place
+///     and retained with the pool block, so the next object allocated from
+///     the same block takes them over together with the allocated capacity
+///     of the lists. As the result, once the lists have grown to accommodate
+///     the received data, reading of the message doesn't allocate any memory.
+/// @tparam TMsg Message type, such as ublox::message::NavPvt<...>.
+/// @tparam TCapacity Number of the message objects in the pool.
+template <typename TMsg, std::size_t TCapacity = 16>
+class PooledMessage : public TMsg
+{
+    using FieldsKeeper = details::PooledFieldsKeeper<!isFixedLengthMsg<TMsg>()>;
+
+public:
+    /// @brief Type of the pool.
+    using Pool = MessagePool<TMsg, TCapacity>;
+
+    /// @brief Default constructor.
+    /// @details Takes over the fields retained by the pool block.
+    PooledMessage()
+    {
+        FieldsKeeper::template restore<TCapacity>(static_cast<TMsg&>(*this), pool().indexOf(this));
+    }
+
+    /// @brief Copy constructor
+    PooledMessage(const PooledMessage&) = default;
+
+    /// @brief Move constructor
+    PooledMessage(PooledMessage&&) = default;
+
+    /// @brief Destructor
+    /// @details Resets the fields and retains them with the pool block.
+    ~PooledMessage()
+    {
+        FieldsKeeper::template retain<TCapacity>(static_cast<TMsg&>(*this), pool().indexOf(this));
+    }
+
+    /// @brief Copy assignment
+    PooledMessage& operator=(const PooledMessage&) = default;
+
+    /// @brief Move assignment
+    PooledMessage& operator=(PooledMessage&&) = default;
+
+    /// @brief Access the pool.
+    static Pool& pool()
+    {
+        return Pool::instance();
+    }
+
+    /// @brief Allocate the message object from the pool.
+    static void* operator new(std::size_t size)
+    {
+        return pool().allocate(size);
+    }
+
+    /// @brief Return the message object to the pool.
+    static void operator delete(void* ptr)
+    {
+        pool().deallocate(ptr);
+    }
+};
+
+namespace details
+{
+
+template <typename TMessages, std::size_t TCapacity>
+struct PooledMessagesOf;
+
+template <typename... TMessages, std::size_t TCapacity>
+struct PooledMessagesOf<std::tuple<TMessages...>, TCapacity>
+{
+    using Type = std::tuple<PooledMessage<TMessages, TCapacity>...>;
+};
+
+template <typename TMessages>
+struct PooledMessagesStatsOf;
+
+template <>
+struct PooledMessagesStatsOf<std::tuple<> >
+{
+    static void add(std::uint64_t&, std::uint64_t&)
+    {
+    }
+
+    static void reset()
+    {
+    }
+};
+
+template <typename TMsg, typename... TRest>
+struct PooledMessagesStatsOf<std::tuple<TMsg, TRest...> >
+{
+    static void add(std::uint64_t& hits, std::uint64_t& misses)
+    {
+        hits += TMsg::pool().hits();
+        misses += TMsg::pool().misses();
+        PooledMessagesStatsOf<std::tuple<TRest...> >::add(hits, misses);
+    }
+
+    static void reset()
+    {
+        TMsg::pool().resetStats();
+        PooledMessagesStatsOf<std::tuple<TRest...> >::reset();
+    }
+};
+
+}  // namespace details
+
+/// @brief Wrap every message type in the tuple with ublox::PooledMessage.
+/// @details Can be used to define the input messages of the protocol stack:
+///     @code
+///     using MyInputMessages = ublox::PooledMessages<ublox::InputMessages<MyInputMessage> >;
+///     using ProtStack = ublox::Stack<MyInputMessage, MyInputMessages>;
+///     @endcode
+/// @tparam TMessages Message types bundled in std::tuple.
+/// @tparam TCapacity Number of the message objects in the pool of every type.
+template <typename TMessages, std::size_t TCapacity = 16>
+using PooledMessages = typename details::PooledMessagesOf<TMessages, TCapacity>::Type;
+
+/// @brief Aggregated hit / miss counters of the message pools.
+struct MessagePoolStats
+{
+    std::uint64_t m_hits = 0U; ///< Number of allocations served by the pools
+    std::uint64_t m_misses = 0U; ///< Number of allocations that used the heap
+};
+
+/// @brief Get aggregated statistics of all the pools of pooled message types.
+/// @tparam TMessages ublox::PooledMessage types bundled in std::tuple,
+///     such as defined by ublox::PooledMessages.
+template <typename TMessages>
+MessagePoolStats pooledMessagesStats()
+{
+    MessagePoolStats stats;
+    details::PooledMessagesStatsOf<TMessages>::add(stats.m_hits, stats.m_misses);
+    return stats;
+}
+
+/// @brief Reset statistics of all the pools of pooled message types.
+/// @tparam TMessages ublox::PooledMessage types bundled in std::tuple.
+template <typename TMessages>
+void resetPooledMessagesStats()
+{
+    details::PooledMessagesStatsOf<TMessages>::reset();
+}
+
+}  // namespace ublox
+
+
@@ -0,0 +1,167 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::MessageView class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+
+#include "comms/comms.h"
+
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TFields, std::size_t TIdx>
+struct ViewFieldOffset
+{
+    using PrevField = typename std::tuple_element<TIdx - 1, TFields>::type;
+    static_assert(PrevField::minLength() == PrevField::maxLength(),
+        "All the fields preceding accessed one must have fixed length");
+
+    static const std::size_t Value =
+        ViewFieldOffset<TFields, TIdx - 1>::Value + PrevField::maxLength();
+};
+
+template <typename TFields>
+struct ViewFieldOffset<TFields, 0U>
+{
+    static const std::size_t Value = 0U;
+};
+
+}  // namespace details
+
+/// @brief Read-only view of the message payload.
+/// @details Wraps the pointer to the serialised payload of the message
+///     with fixed layout and decodes the
+///     requested field only when its accessor is called. Nothing is
+///     copied upon construction. The returned fields are of the same types as
+///     defined in relevant @b *Fields struct (for example ublox::message::NavPvtFields),
+///     so all the scaling and units conversion functionality of the @b COMMS library
+///     is applicable:
+///     @code
+///     ublox::view::NavPvt view(payload, payloadLen);
+///     auto lat = comms::units::getDegrees<double>(view.field_lat());
+///     @endcode
+///     The viewed buffer must outlive the view object.
+/// @tparam TMsg Type of the message with fixed layout, such as ublox::message::NavPvt<>.
+///     Only fields that are preceded by fields with fixed serialisation length can be
+///     accessed.
+template <typename TMsg>
+class MessageView
+{
+public:
+    /// @brief Type of the viewed message.
+    using Msg = TMsg;
+
+    /// @brief All the fields of the message bundled in std::tuple.
+    using AllFields = typename Msg::AllFields;
+
+    /// @brief Type of the field with specified index.
+    template <std::size_t TIdx>
+    using FieldType = typename std::tuple_element<TIdx, AllFields>::type;
+
+    /// @brief Constructor.
+    /// @param[in] payload Pointer to the message payload.
+    /// @param[in] len Length of the message payload.
+    MessageView(const std::uint8_t* payload, std::size_t len)
+      : m_payload(payload),
+        m_len(len)
+    {
+    }
+
+    /// @brief Get pointer to the viewed payload.
+    const std::uint8_t* payload() const
+    {
+        return m_payload;
+    }
+
+    /// @brief Get length of the viewed payload.
+    std::size_t payloadLength() const
+    {
+        return m_len;
+    }
+
+    /// @brief Get offset of the field with specified index within the payload.
+    template <std::size_t TIdx>
+    static constexpr std::size_t fieldOffset()
+    {
+        return details::ViewFieldOffset<AllFields, TIdx>::Value;
+    }
+
+    /// @brief Check whether the payload contains the field with specified index.
+    template <std::size_t TIdx>
+    bool hasField() const
+    {
+        return (fieldOffset<TIdx>() + FieldType<TIdx>::minLength()) <= m_len;
+    }
+
+    /// @brief Decode and return the field with specified index.
+    /// @details Reads only the requested field. If the payload is too short,
+    ///     default constructed field is returned.
+    template <std::size_t TIdx>
+    FieldType<TIdx> field() const
+    {
+        FieldType<TIdx> result;
+        if (!hasField<TIdx>()) {
+            return result;
+        }
+
+        auto offset = fieldOffset<TIdx>();
+        const std::uint8_t* iter = m_payload + offset;
+        auto es = result.read(iter, m_len - offset);
+        static_cast<void>(es);
+        GASSERT(es == comms::ErrorStatus::Success);
+        return result;
+    }
+
+private:
+    const std::uint8_t* m_payload = nullptr;
+    std::size_t m_len = 0U;
+};
+
+/// @brief Create view of the message payload from the full frame.
+/// @tparam TView Type of the view, such as ublox::view::NavPvt.
+/// @param[in] frame Pointer to the first synchronisation byte of the valid
+///     frame (see ublox::FrameSplitter).
+template <typename TView>
+TView makeView(const std::uint8_t* frame)
+{
+    return TView(frame + protocol::FrameHeaderLength, protocol::framePayloadLength(frame));
+}
+
+}  // namespace ublox
+
+/// @brief Provide named accessor to the field of the message view.
+/// @details To be used inside the definition of a class derived from
+///     ublox::MessageView. Generates @b field_name() member function, which
+///     returns the field referenced by @b FieldIdx_name index of the viewed message.
+#define UBLOX_VIEW_FIELD(name_) \
+    FieldType<Msg::FieldIdx_ ## name_> field_ ## name_() const \
+    { \
+        return this->template field<Msg::FieldIdx_ ## name_>(); \
+    }
+
+
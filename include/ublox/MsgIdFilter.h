@@ -0,0 +1,206 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::MsgIdFilter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <limits>
+#include <algorithm>
+
+#include "MsgId.h"
+
+namespace ublox
+{
+
+/// @brief Runtime configurable filter of the message IDs.
+/// @details Keeps a mask with a bit for every possible message ID (8KB),
+///     so the check whether the message is accepted is a single bit test.
+///     By default all the messages are accepted.
+///
+///     It also counts the rejected frames per message ID. Up to
+///     @ref MaxTrackedIds distinct IDs are tracked individually, drops of
+///     other IDs are reported by @ref droppedUntracked().
+///     The filter doesn't allocate any memory.
+/// @see ublox::FilteredStack
+class MsgIdFilter
+{
+public:
+    /// @brief Maximal number of distinct rejected message IDs with individual counters.
+    static const std::size_t MaxTrackedIds = 64U;
+
+    /// @brief Constructor, accepts all the messages.
+    MsgIdFilter()
+    {
+        acceptAll();
+    }
+
+    /// @brief Accept all the messages.
+    void acceptAll()
+    {
+        m_mask.fill(std::numeric_limits<std::uint64_t>::max());
+    }
+
+    /// @brief Reject all the messages.
+    void rejectAll()
+    {
+        m_mask.fill(0U);
+    }
+
+    /// @brief Accept message with specified ID.
+    void accept(MsgId id)
+    {
+        m_mask[wordIdx(id)] |= bitMask(id);
+    }
+
+    /// @brief Reject message with specified ID.
+    void reject(MsgId id)
+    {
+        m_mask[wordIdx(id)] &= ~bitMask(id);
+    }
+
+    /// @brief Accept all the messages of specified class.
+    /// @param[in] cls Class ID, such as 0x01 for @b NAV.
+    void acceptClass(std::uint8_t cls)
+    {
+        auto begin = m_mask.begin() + (cls * WordsPerClass);
+        std::fill(begin, begin + WordsPerClass, std::numeric_limits<std::uint64_t>::max());
+    }
+
+    /// @brief Reject all the messages of specified class.
+    /// @param[in] cls Class ID, such as 0x01 for @b NAV.
+    void rejectClass(std::uint8_t cls)
+    {
+        auto begin = m_mask.begin() + (cls * WordsPerClass);
+        std::fill(begin, begin + WordsPerClass, 0U);
+    }
+
+    /// @brief Check whether message with specified ID is accepted.
+    bool accepts(MsgId id) const
+    {
+        return (m_mask[wordIdx(id)] & bitMask(id)) != 0U;
+    }
+
+    /// @brief Record rejection of the frame with specified message ID.
+    void recordDrop(MsgId id)
+    {
+        ++m_dropped;
+        auto idx = static_cast<std::size_t>(id) % MaxTrackedIds;
+        for (auto count = 0U; count < MaxTrackedIds; ++count) {
+            auto& slot = m_drops[idx];
+            if (slot.m_count == 0U) {
+                slot.m_id = id;
+            }
+
+            if (slot.m_id == id) {
+                ++slot.m_count;
+                return;
+            }
+
+            idx = (idx + 1) % MaxTrackedIds;
+        }
+
+        ++m_droppedUntracked;
+    }
+
+    /// @brief Get total number of rejected frames.
+    std::uint64_t dropped() const
+    {
+        return m_dropped;
+    }
+
+    /// @brief Get number of rejected frames with specified message ID.
+    /// @details Returns 0 for the IDs which are not tracked.
+    std::uint64_t dropped(MsgId id) const
+    {
+        auto idx = static_cast<std::size_t>(id) % MaxTrackedIds;
+        for (auto count = 0U; count < MaxTrackedIds; ++count) {
+            auto& slot = m_drops[idx];
+            if (slot.m_count == 0U) {
+                break;
+            }
+
+            if (slot.m_id == id) {
+                return slot.m_count;
+            }
+
+            idx = (idx + 1) % MaxTrackedIds;
+        }
+        return 0U;
+    }
+
+    /// @brief Get number of rejected frames, which IDs are not tracked individually.
+    std::uint64_t droppedUntracked() const
+    {
+        return m_droppedUntracked;
+    }
+
+    /// @brief Invoke provided function for every tracked rejected message ID.
+    /// @param[in] func Function with <b>void (ublox::MsgId, std::uint64_t)</b>
+    ///     signature, receives ID and number of rejected frames.
+    template <typename TFunc>
+    void forEachDropped(TFunc&& func) const
+    {
+        for (auto& slot : m_drops) {
+            if (slot.m_count != 0U) {
+                func(slot.m_id, slot.m_count);
+            }
+        }
+    }
+
+    /// @brief Reset all the drop counters.
+    void resetDropped()
+    {
+        m_drops.fill(DropSlot());
+        m_dropped = 0U;
+        m_droppedUntracked = 0U;
+    }
+
+private:
+    struct DropSlot
+    {
+        MsgId m_id = MsgId();
+        std::uint64_t m_count = 0U;
+    };
+
+    static const std::size_t BitsPerWord = std::numeric_limits<std::uint64_t>::digits;
+    static const std::size_t NumOfIds = static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()) + 1U;
+    static const std::size_t WordsPerClass = (std::numeric_limits<std::uint8_t>::max() + 1U) / BitsPerWord;
+
+    static std::size_t wordIdx(MsgId id)
+    {
+        return static_cast<std::size_t>(id) / BitsPerWord;
+    }
+
+    static std::uint64_t bitMask(MsgId id)
+    {
+        return std::uint64_t(1U) << (static_cast<std::size_t>(id) % BitsPerWord);
+    }
+
+    std::array<std::uint64_t, NumOfIds / BitsPerWord> m_mask;
+    std::array<DropSlot, MaxTrackedIds> m_drops;
+    std::uint64_t m_dropped = 0U;
+    std::uint64_t m_droppedUntracked = 0U;
+};
+
+}  // namespace ublox
+
+
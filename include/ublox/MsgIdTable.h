@@ -0,0 +1,215 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::MsgIdTable class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <tuple>
+#include <limits>
+
+#include "MsgId.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+/// @brief Retrieve numeric ID of the message class defined using
+///     @b comms::option::StaticNumIdImpl option.
+template <typename TMsg>
+struct MsgIdOf
+{
+    static_assert(TMsg::ImplOptions::HasStaticMsgId,
+        "The message must be defined with comms::option::StaticNumIdImpl option");
+
+    static const std::uint16_t Value = static_cast<std::uint16_t>(TMsg::ImplOptions::MsgId);
+};
+
+template <typename TMessages>
+struct MsgIdsOf;
+
+template <typename... TMessages>
+struct MsgIdsOf<std::tuple<TMessages...> >
+{
+    static const std::size_t Size = sizeof...(TMessages);
+
+    // Extra element avoids zero sized array for empty tuple
+    static constexpr std::uint16_t Values[sizeof...(TMessages) + 1] = {MsgIdOf<TMessages>::Value..., 0U};
+};
+
+template <typename... TMessages>
+constexpr std::uint16_t MsgIdsOf<std::tuple<TMessages...> >::Values[sizeof...(TMessages) + 1];
+
+inline
+constexpr std::uint8_t msgIdClass(std::uint16_t id)
+{
+    return static_cast<std::uint8_t>(id >> std::numeric_limits<std::uint8_t>::digits);
+}
+
+inline
+constexpr std::uint8_t msgIdLow(std::uint16_t id)
+{
+    return static_cast<std::uint8_t>(id & std::numeric_limits<std::uint8_t>::max());
+}
+
+// Uses binary split recursion to keep the constexpr evaluation depth low
+inline
+constexpr bool msgIdsHaveClass(const std::uint16_t* ids, std::size_t from, std::size_t to, std::uint8_t cls)
+{
+    return
+        (to <= from) ? false :
+        ((to - from) == 1U) ? (msgIdClass(ids[from]) == cls) :
+            (msgIdsHaveClass(ids, from, from + ((to - from) / 2), cls) ||
+             msgIdsHaveClass(ids, from + ((to - from) / 2), to, cls));
+}
+
+inline
+constexpr std::size_t msgIdsClassCount(const std::uint16_t* ids, std::size_t from, std::size_t to)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ? (msgIdsHaveClass(ids, 0U, from, msgIdClass(ids[from])) ? 0U : 1U) :
+            (msgIdsClassCount(ids, from, from + ((to - from) / 2)) +
+             msgIdsClassCount(ids, from + ((to - from) / 2), to));
+}
+
+inline
+constexpr std::size_t msgIdsCount(const std::uint16_t* ids, std::size_t from, std::size_t to, std::uint16_t id)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ? ((ids[from] == id) ? 1U : 0U) :
+            (msgIdsCount(ids, from, from + ((to - from) / 2), id) +
+             msgIdsCount(ids, from + ((to - from) / 2), to, id));
+}
+
+}  // namespace details
+
+/// @brief Constant time lookup of the message types by their IDs.
+/// @details Maps numeric ID of the message to the index of its type in
+///     the @b TMessages tuple using two level table: the class byte selects
+///     per-class table of 256 entries, which is indexed by the ID byte.
+///     The IDs of the messages and number of the message classes are
+///     evaluated at compile time, the table itself (about 512 bytes per class)
+///     is materialised upon first use. Multiple message types with the same
+///     ID (such as ublox::message::CfgPrtUart and ublox::message::CfgPrtUsb)
+///     are chained in the order of their appearance in the tuple.
+/// @tparam TMessages All the message types bundled in std::tuple. Every
+///     message must be defined with @b comms::option::StaticNumIdImpl option.
+template <typename TMessages>
+class MsgIdTable
+{
+    using Ids = details::MsgIdsOf<TMessages>;
+
+public:
+    /// @brief Number of the message types.
+    static const std::size_t NumOfMessages = Ids::Size;
+
+    /// @brief Number of the distinct message classes.
+    static const std::size_t NumOfClasses =
+        details::msgIdsClassCount(Ids::Values, 0U, NumOfMessages);
+
+    /// @brief Index returned when the message type is not found.
+    static const std::size_t NotFound = NumOfMessages;
+
+    static_assert(NumOfMessages < std::numeric_limits<std::uint16_t>::max(),
+        "Too many messages");
+
+    /// @brief Get ID of the message type with specified index.
+    static constexpr MsgId msgId(std::size_t idx)
+    {
+        return static_cast<MsgId>(Ids::Values[idx]);
+    }
+
+    /// @brief Get number of the message types with specified ID.
+    /// @details Evaluated at compile time for constant ID, so it can be used
+    ///     to check that the ID identifies single message type.
+    static constexpr std::size_t count(MsgId id)
+    {
+        return details::msgIdsCount(Ids::Values, 0U, NumOfMessages, static_cast<std::uint16_t>(id));
+    }
+
+    /// @brief Find index of the first message type with specified ID.
+    /// @return Index of the type in @b TMessages tuple, @ref NotFound if none.
+    static std::size_t find(MsgId id)
+    {
+        auto& tab = table();
+        auto slot = tab.m_classSlots[details::msgIdClass(id)];
+        if (slot == 0U) {
+            return NotFound;
+        }
+
+        return static_cast<std::size_t>(tab.m_first[slot - 1][details::msgIdLow(id)]);
+    }
+
+    /// @brief Find index of the next message type with the same ID.
+    /// @param[in] idx Index of the message type previously returned by
+    ///     @ref find() or @ref next().
+    /// @return Index of the type in @b TMessages tuple, @ref NotFound if none.
+    static std::size_t next(std::size_t idx)
+    {
+        return static_cast<std::size_t>(table().m_next[idx]);
+    }
+
+private:
+    struct Table
+    {
+        Table()
+        {
+            m_classSlots.fill(0U);
+            for (auto& elems : m_first) {
+                elems.fill(static_cast<std::uint16_t>(NotFound));
+            }
+
+            std::size_t slotsCount = 0U;
+            for (auto idx = NumOfMessages; 0U < idx; --idx) {
+                auto msgIdx = idx - 1U;
+                auto id = Ids::Values[msgIdx];
+                auto& slot = m_classSlots[details::msgIdClass(id)];
+                if (slot == 0U) {
+                    ++slotsCount;
+                    slot = static_cast<std::uint16_t>(slotsCount);
+                }
+
+                // Iterating backwards, so the first type with the ID ends up in the table
+                auto& first = m_first[slot - 1][details::msgIdLow(id)];
+                m_next[msgIdx] = first;
+                first = static_cast<std::uint16_t>(msgIdx);
+            }
+        }
+
+        std::array<std::uint16_t, 256> m_classSlots;
+        std::array<std::array<std::uint16_t, 256>, NumOfClasses> m_first;
+        std::array<std::uint16_t, NumOfMessages + 1> m_next = {{0U}};
+    };
+
+    static const Table& table()
+    {
+        static const Table Tab;
+        return Tab;
+    }
+};
+
+}  // namespace ublox
+
+
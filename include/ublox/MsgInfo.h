@@ -0,0 +1,502 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of compile time metadata of the messages.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "MsgId.h"
+#include "MsgIdTable.h"
+
+namespace ublox
+{
+
+/// @brief Metadata of the message type.
+/// @see ublox::MsgRegistry
+struct MsgInfo
+{
+    MsgId m_id; ///< ID (class and ID) of the message
+    const char* m_name; ///< Canonical name of the message, such as "NAV-PVT"
+    std::size_t m_minLength; ///< Minimal length of the payload
+    std::size_t m_maxLength; ///< Maximal length of the payload
+    bool m_fixedLength; ///< Whether the payload length is fixed
+
+    /// @brief Get class ID of the message.
+    constexpr std::uint8_t classId() const
+    {
+        return details::msgIdClass(m_id);
+    }
+
+    /// @brief Get ID of the message within its class.
+    constexpr std::uint8_t msgId() const
+    {
+        return details::msgIdLow(m_id);
+    }
+};
+
+namespace details
+{
+
+struct MsgNameEntry
+{
+    MsgId m_id;
+    const char* m_name;
+};
+
+// Sorted list of the names of all the known messages
+template <typename T = void>
+struct MsgNames
+{
+    static constexpr MsgNameEntry Values[] = {
+        {MsgId_NAV_POSECEF, "NAV-POSECEF"},
+        {MsgId_NAV_POSLLH, "NAV-POSLLH"},
+        {MsgId_NAV_STATUS, "NAV-STATUS"},
+        {MsgId_NAV_DOP, "NAV-DOP"},
+        {MsgId_NAV_ATT, "NAV-ATT"},
+        {MsgId_NAV_SOL, "NAV-SOL"},
+        {MsgId_NAV_PVT, "NAV-PVT"},
+        {MsgId_NAV_ODO, "NAV-ODO"},
+        {MsgId_NAV_RESETODO, "NAV-RESETODO"},
+        {MsgId_NAV_VELECEF, "NAV-VELECEF"},
+        {MsgId_NAV_VELNED, "NAV-VELNED"},
+        {MsgId_NAV_HPPOSECEF, "NAV-HPPOSECEF"},
+        {MsgId_NAV_HPPOSLLH, "NAV-HPPOSLLH"},
+        {MsgId_NAV_TIMEGPS, "NAV-TIMEGPS"},
+        {MsgId_NAV_TIMEUTC, "NAV-TIMEUTC"},
+        {MsgId_NAV_CLOCK, "NAV-CLOCK"},
+        {MsgId_NAV_TIMEGLO, "NAV-TIMEGLO"},
+        {MsgId_NAV_TIMEBDS, "NAV-TIMEBDS"},
+        {MsgId_NAV_TIMEGAL, "NAV-TIMEGAL"},
+        {MsgId_NAV_TIMELS, "NAV-TIMELS"},
+        {MsgId_NAV_SVINFO, "NAV-SVINFO"},
+        {MsgId_NAV_DGPS, "NAV-DGPS"},
+        {MsgId_NAV_SBAS, "NAV-SBAS"},
+        {MsgId_NAV_ORB, "NAV-ORB"},
+        {MsgId_NAV_SAT, "NAV-SAT"},
+        {MsgId_NAV_GEOFENCE, "NAV-GEOFENCE"},
+        {MsgId_NAV_SVIN, "NAV-SVIN"},
+        {MsgId_NAV_RELPOSNED, "NAV-RELPOSNED"},
+        {MsgId_NAV_EKFSTATUS, "NAV-EKFSTATUS"},
+        {MsgId_NAV_AOPSTATUS, "NAV-AOPSTATUS"},
+        {MsgId_NAV_EOE, "NAV-EOE"},
+
+        {MsgId_RXM_RAW, "RXM-RAW"},
+        {MsgId_RXM_SFRB, "RXM-SFRB"},
+        {MsgId_RXM_SFRBX, "RXM-SFRBX"},
+        {MsgId_RXM_MEASX, "RXM-MEASX"},
+        {MsgId_RXM_RAWX, "RXM-RAWX"},
+        {MsgId_RXM_SVSI, "RXM-SVSI"},
+        {MsgId_RXM_ALM, "RXM-ALM"},
+        {MsgId_RXM_EPH, "RXM-EPH"},
+        {MsgId_RXM_RTCM, "RXM-RTCM"},
+        {MsgId_RXM_PMREQ, "RXM-PMREQ"},
+        {MsgId_RXM_RLM, "RXM-RLM"},
+        {MsgId_RXM_IMES, "RXM-IMES"},
+
+        {MsgId_INF_ERROR, "INF-ERROR"},
+        {MsgId_INF_WARNING, "INF-WARNING"},
+        {MsgId_INF_NOTICE, "INF-NOTICE"},
+        {MsgId_INF_TEST, "INF-TEST"},
+        {MsgId_INF_DEBUG, "INF-DEBUG"},
+
+        {MsgId_ACK_NAK, "ACK-NAK"},
+        {MsgId_ACK_ACK, "ACK-ACK"},
+
+        {MsgId_CFG_PRT, "CFG-PRT"},
+        {MsgId_CFG_MSG, "CFG-MSG"},
+        {MsgId_CFG_INF, "CFG-INF"},
+        {MsgId_CFG_RST, "CFG-RST"},
+        {MsgId_CFG_DAT, "CFG-DAT"},
+        {MsgId_CFG_TP, "CFG-TP"},
+        {MsgId_CFG_RATE, "CFG-RATE"},
+        {MsgId_CFG_CFG, "CFG-CFG"},
+        {MsgId_CFG_FXN, "CFG-FXN"},
+        {MsgId_CFG_RXM, "CFG-RXM"},
+        {MsgId_CFG_EKF, "CFG-EKF"},
+        {MsgId_CFG_ANT, "CFG-ANT"},
+        {MsgId_CFG_SBAS, "CFG-SBAS"},
+        {MsgId_CFG_NMEA, "CFG-NMEA"},
+        {MsgId_CFG_USB, "CFG-USB"},
+        {MsgId_CFG_TMODE, "CFG-TMODE"},
+        {MsgId_CFG_ODO, "CFG-ODO"},
+        {MsgId_CFG_NVS, "CFG-NVS"},
+        {MsgId_CFG_NAVX5, "CFG-NAVX5"},
+        {MsgId_CFG_NAV5, "CFG-NAV5"},
+        {MsgId_CFG_ESFGWT, "CFG-ESFGWT"},
+        {MsgId_CFG_TP5, "CFG-TP5"},
+        {MsgId_CFG_PM, "CFG-PM"},
+        {MsgId_CFG_RINV, "CFG-RINV"},
+        {MsgId_CFG_ITFM, "CFG-ITFM"},
+        {MsgId_CFG_PM2, "CFG-PM2"},
+        {MsgId_CFG_TMODE2, "CFG-TMODE2"},
+        {MsgId_CFG_GNSS, "CFG-GNSS"},
+        {MsgId_CFG_LOGFILTER, "CFG-LOGFILTER"},
+        {MsgId_CFG_TXSLOT, "CFG-TXSLOT"},
+        {MsgId_CFG_PWR, "CFG-PWR"},
+        {MsgId_CFG_HNR, "CFG-HNR"},
+        {MsgId_CFG_ESRC, "CFG-ESRC"},
+        {MsgId_CFG_DOSC, "CFG-DOSC"},
+        {MsgId_CFG_SMGR, "CFG-SMGR"},
+        {MsgId_CFG_GEOFENCE, "CFG-GEOFENCE"},
+        {MsgId_CFG_DGNSS, "CFG-DGNSS"},
+        {MsgId_CFG_TMODE3, "CFG-TMODE3"},
+        {MsgId_CFG_FIXSEED, "CFG-FIXSEED"},
+        {MsgId_CFG_DYNSEED, "CFG-DYNSEED"},
+        {MsgId_CFG_PMS, "CFG-PMS"},
+
+        {MsgId_UPD_SOS, "UPD-SOS"},
+
+        {MsgId_MON_IO, "MON-IO"},
+        {MsgId_MON_VER, "MON-VER"},
+        {MsgId_MON_MSGPP, "MON-MSGPP"},
+        {MsgId_MON_RXBUF, "MON-RXBUF"},
+        {MsgId_MON_TXBUF, "MON-TXBUF"},
+        {MsgId_MON_HW, "MON-HW"},
+        {MsgId_MON_HW2, "MON-HW2"},
+        {MsgId_MON_RXR, "MON-RXR"},
+        {MsgId_MON_PATCH, "MON-PATCH"},
+        {MsgId_MON_GNSS, "MON-GNSS"},
+        {MsgId_MON_SMGR, "MON-SMGR"},
+
+        {MsgId_AID_REQ, "AID-REQ"},
+        {MsgId_AID_INI, "AID-INI"},
+        {MsgId_AID_HUI, "AID-HUI"},
+        {MsgId_AID_DATA, "AID-DATA"},
+        {MsgId_AID_ALM, "AID-ALM"},
+        {MsgId_AID_EPH, "AID-EPH"},
+        {MsgId_AID_ALPSRV, "AID-ALPSRV"},
+        {MsgId_AID_AOP, "AID-AOP"},
+        {MsgId_AID_ALP, "AID-ALP"},
+
+        {MsgId_TIM_TP, "TIM-TP"},
+        {MsgId_TIM_TM2, "TIM-TM2"},
+        {MsgId_TIM_SVIN, "TIM-SVIN"},
+        {MsgId_TIM_VRFY, "TIM-VRFY"},
+        {MsgId_TIM_DOSC, "TIM-DOSC"},
+        {MsgId_TIM_TOS, "TIM-TOS"},
+        {MsgId_TIM_SMEAS, "TIM-SMEAS"},
+        {MsgId_TIM_VCOCAL, "TIM-VCOCAL"},
+        {MsgId_TIM_FCHG, "TIM-FCHG"},
+        {MsgId_TIM_HOC, "TIM-HOC"},
+
+        {MsgId_ESF_MEAS, "ESF-MEAS"},
+        {MsgId_ESF_RAW, "ESF-RAW"},
+        {MsgId_ESF_STATUS, "ESF-STATUS"},
+        {MsgId_ESF_INS, "ESF-INS"},
+
+        {MsgId_MGA_GPS, "MGA-GPS"},
+        {MsgId_MGA_GAL, "MGA-GAL"},
+        {MsgId_MGA_BDS, "MGA-BDS"},
+        {MsgId_MGA_QZSS, "MGA-QZSS"},
+        {MsgId_MGA_GLO, "MGA-GLO"},
+        {MsgId_MGA_ANO, "MGA-ANO"},
+        {MsgId_MGA_FLASH, "MGA-FLASH"},
+        {MsgId_MGA_INI, "MGA-INI"},
+        {MsgId_MGA_ACK, "MGA-ACK"},
+        {MsgId_MGA_DBD, "MGA-DBD"},
+
+        {MsgId_LOG_ERASE, "LOG-ERASE"},
+        {MsgId_LOG_STRING, "LOG-STRING"},
+        {MsgId_LOG_CREATE, "LOG-CREATE"},
+        {MsgId_LOG_INFO, "LOG-INFO"},
+        {MsgId_LOG_RETRIEVE, "LOG-RETRIEVE"},
+        {MsgId_LOG_RETRIEVEPOS, "LOG-RETRIEVEPOS"},
+        {MsgId_LOG_RETRIEVESTRING, "LOG-RETRIEVESTRING"},
+        {MsgId_LOG_FINDTIME, "LOG-FINDTIME"},
+        {MsgId_LOG_RETRIEVEPOSEXTRA, "LOG-RETRIEVEPOSEXTRA"},
+
+        {MsgId_SEC_SIGN, "SEC-SIGN"},
+        {MsgId_SEC_UNIQID, "SEC-UNIQID"},
+
+        {MsgId_HNR_PVT, "HNR-PVT"},
+    };
+
+    static const std::size_t Size = std::extent<decltype(Values)>::value;
+};
+
+template <typename T>
+constexpr MsgNameEntry MsgNames<T>::Values[];
+
+// Binary search of the name, the range is expected to be sorted
+inline
+constexpr const char* msgNameFind(MsgId id, std::size_t from, std::size_t to)
+{
+    return
+        (to <= from) ? "" :
+        ((to - from) == 1U) ? ((MsgNames<>::Values[from].m_id == id) ? MsgNames<>::Values[from].m_name : "") :
+        (id < MsgNames<>::Values[from + ((to - from) / 2)].m_id) ?
+            msgNameFind(id, from, from + ((to - from) / 2)) :
+            msgNameFind(id, from + ((to - from) / 2), to);
+}
+
+inline
+constexpr bool msgNamesSorted(std::size_t from, std::size_t to)
+{
+    return
+        ((to - from) <= 1U) ? true :
+        ((to - from) == 2U) ? (MsgNames<>::Values[from].m_id < MsgNames<>::Values[from + 1].m_id) :
+            (msgNamesSorted(from, from + ((to - from) / 2) + 1) &&
+             msgNamesSorted(from + ((to - from) / 2), to));
+}
+
+inline
+constexpr std::size_t msgNamesClassCount(std::size_t from, std::size_t to)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ?
+            (((from == 0U) ||
+              (msgIdClass(MsgNames<>::Values[from - 1].m_id) != msgIdClass(MsgNames<>::Values[from].m_id))) ? 1U : 0U) :
+            (msgNamesClassCount(from, from + ((to - from) / 2)) +
+             msgNamesClassCount(from + ((to - from) / 2), to));
+}
+
+static_assert(msgNamesSorted(0U, MsgNames<>::Size), "The names must be sorted by ID");
+static_assert(MsgNames<>::Size < std::numeric_limits<std::uint8_t>::max(), "Too many names");
+
+class MsgNamesTable
+{
+public:
+    static const char* find(MsgId id)
+    {
+        auto& tab = table();
+        auto slot = tab.m_classSlots[msgIdClass(id)];
+        if (slot == 0U) {
+            return "";
+        }
+
+        auto idx = tab.m_indices[slot - 1][msgIdLow(id)];
+        if (idx == NotFound) {
+            return "";
+        }
+        return MsgNames<>::Values[idx].m_name;
+    }
+
+private:
+    static const std::size_t NumOfClasses = msgNamesClassCount(0U, MsgNames<>::Size);
+    static const std::uint8_t NotFound = std::numeric_limits<std::uint8_t>::max();
+
+    struct Table
+    {
+        Table()
+        {
+            m_classSlots.fill(0U);
+            for (auto& elems : m_indices) {
+                elems.fill(NotFound);
+            }
+
+            std::uint8_t slotsCount = 0U;
+            for (auto idx = 0U; idx < MsgNames<>::Size; ++idx) {
+                auto id = MsgNames<>::Values[idx].m_id;
+                auto& slot = m_classSlots[msgIdClass(id)];
+                if (slot == 0U) {
+                    ++slotsCount;
+                    slot = slotsCount;
+                }
+                m_indices[slot - 1][msgIdLow(id)] = static_cast<std::uint8_t>(idx);
+            }
+        }
+
+        std::array<std::uint8_t, 256> m_classSlots;
+        std::array<std::array<std::uint8_t, 256>, NumOfClasses> m_indices;
+    };
+
+    static const Table& table()
+    {
+        static const Table Tab;
+        return Tab;
+    }
+};
+
+template <typename TFields, std::size_t TCount = std::tuple_size<TFields>::value>
+struct MsgFieldsLength
+{
+    using LastField = typename std::tuple_element<TCount - 1, TFields>::type;
+    using Prev = MsgFieldsLength<TFields, TCount - 1>;
+
+    static const std::size_t MinValue = Prev::MinValue + LastField::minLength();
+    static const std::size_t MaxValue =
+        ((std::numeric_limits<std::uint16_t>::max() - Prev::MaxValue) < LastField::maxLength()) ?
+            std::numeric_limits<std::uint16_t>::max() :
+            (Prev::MaxValue + LastField::maxLength());
+};
+
+template <typename TFields>
+struct MsgFieldsLength<TFields, 0U>
+{
+    static const std::size_t MinValue = 0U;
+    static const std::size_t MaxValue = 0U;
+};
+
+template <typename TMsg>
+constexpr MsgInfo makeMsgInfo()
+{
+    using Lengths = MsgFieldsLength<typename TMsg::AllFields>;
+    return MsgInfo{
+        static_cast<MsgId>(MsgIdOf<TMsg>::Value),
+        msgNameFind(static_cast<MsgId>(MsgIdOf<TMsg>::Value), 0U, MsgNames<>::Size),
+        Lengths::MinValue,
+        Lengths::MaxValue,
+        Lengths::MinValue == Lengths::MaxValue};
+}
+
+template <typename TMessages>
+struct MsgInfosOf;
+
+template <typename... TMessages>
+struct MsgInfosOf<std::tuple<TMessages...> >
+{
+    // Extra element avoids zero sized array for empty tuple
+    static constexpr MsgInfo Values[sizeof...(TMessages) + 1] =
+        {makeMsgInfo<TMessages>()..., MsgInfo{MsgId(), "", 0U, 0U, true}};
+};
+
+template <typename... TMessages>
+constexpr MsgInfo MsgInfosOf<std::tuple<TMessages...> >::Values[sizeof...(TMessages) + 1];
+
+inline
+constexpr std::size_t msgInfosMaxLength(const MsgInfo* infos, std::size_t from, std::size_t to)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ? infos[from].m_maxLength :
+        (msgInfosMaxLength(infos, from, from + ((to - from) / 2)) <
+         msgInfosMaxLength(infos, from + ((to - from) / 2), to)) ?
+            msgInfosMaxLength(infos, from + ((to - from) / 2), to) :
+            msgInfosMaxLength(infos, from, from + ((to - from) / 2));
+}
+
+}  // namespace details
+
+/// @brief Get canonical name of the message, such as "NAV-PVT".
+/// @details Constant time lookup in the table of all the IDs
+///     listed in ublox::MsgId enum.
+/// @return Name of the message, empty string for unknown ID.
+inline
+const char* msgName(MsgId id)
+{
+    return details::MsgNamesTable::find(id);
+}
+
+/// @brief Find ID of the message by its canonical name, such as "NAV-PVT".
+/// @details Linear search over the names of all the IDs
+///     listed in ublox::MsgId enum, intended for parsing of the user input.
+/// @param[in] name Name of the message.
+/// @param[out] id ID of the message, not updated if the name is unknown.
+/// @return @b true if the name is known, @b false otherwise.
+inline
+bool msgIdByName(const char* name, MsgId& id)
+{
+    for (auto& entry : details::MsgNames<>::Values) {
+        if (std::strcmp(entry.m_name, name) == 0) {
+            id = entry.m_id;
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Find class ID of the messages by the class name, such as "NAV".
+/// @param[in] name Name of the class.
+/// @param[out] classId Class ID, not updated if the name is unknown.
+/// @return @b true if the name is known, @b false otherwise.
+inline
+bool msgClassByName(const char* name, std::uint8_t& classId)
+{
+    auto len = std::strlen(name);
+    for (auto& entry : details::MsgNames<>::Values) {
+        if ((std::strncmp(entry.m_name, name, len) == 0) && (entry.m_name[len] == '-')) {
+            classId = details::msgIdClass(entry.m_id);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Compile time metadata of the message types.
+/// @details Holds an entry (ublox::MsgInfo) per message type, with its ID, name,
+///     and minimal and maximal payload length calculated from the fields of the
+///     message. All the entries are available at compile time, for example
+///     to size the buffers:
+///     @code
+///     using Registry = ublox::MsgRegistry<AllInputMessages>;
+///     using InNavPvt = ublox::message::NavPvt<MyInputMessage>;
+///     std::array<std::uint8_t, Registry::info<InNavPvt>().m_maxLength + ublox::protocol::FrameOverheadLength> buf;
+///     @endcode
+///     The entries may also be looked up by ID in constant time using
+///     ublox::MsgIdTable. The maximal length of the variable length messages
+///     is limited by the maximal payload length of the frame (65535).
+/// @tparam TMessages All the message types bundled in std::tuple. Every
+///     message must be defined with @b comms::option::StaticNumIdImpl option.
+template <typename TMessages>
+class MsgRegistry
+{
+    using Infos = details::MsgInfosOf<TMessages>;
+
+public:
+    /// @brief Table mapping IDs to indices of the message types.
+    using IdTable = MsgIdTable<TMessages>;
+
+    /// @brief Number of the message types.
+    static const std::size_t NumOfMessages = IdTable::NumOfMessages;
+
+    /// @brief Get metadata of the message type at compile time.
+    template <typename TMsg>
+    static constexpr MsgInfo info()
+    {
+        return details::makeMsgInfo<TMsg>();
+    }
+
+    /// @brief Get metadata of the message type with specified index in @b TMessages.
+    static constexpr const MsgInfo& at(std::size_t idx)
+    {
+        return Infos::Values[idx];
+    }
+
+    /// @brief Find metadata of the first message type with specified ID.
+    /// @details Other message types with the same ID (if any) can be
+    ///     found using IdTable::find() and IdTable::next().
+    /// @return Pointer to the metadata, @b nullptr if not found.
+    static const MsgInfo* find(MsgId id)
+    {
+        auto idx = IdTable::find(id);
+        if (idx == IdTable::NotFound) {
+            return nullptr;
+        }
+        return &Infos::Values[idx];
+    }
+
+    /// @brief Get maximal payload length among all the message types.
+    static constexpr std::size_t maxPayloadLength()
+    {
+        return details::msgInfosMaxLength(Infos::Values, 0U, NumOfMessages);
+    }
+};
+
+}  // namespace ublox
+
+
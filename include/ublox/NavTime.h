@@ -0,0 +1,306 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains functions retrieving GPS time of the navigation epoch
+///     from the raw payload of the @b NAV messages.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "MsgId.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+inline
+std::uint16_t navReadU16(const std::uint8_t* data)
+{
+    return static_cast<std::uint16_t>(data[0] | (static_cast<unsigned>(data[1]) << 8U));
+}
+
+inline
+std::uint32_t navReadU32(const std::uint8_t* data)
+{
+    return
+        static_cast<std::uint32_t>(data[0]) |
+        (static_cast<std::uint32_t>(data[1]) << 8U) |
+        (static_cast<std::uint32_t>(data[2]) << 16U) |
+        (static_cast<std::uint32_t>(data[3]) << 24U);
+}
+
+// Number of days since 1970-01-01 of the proleptic Gregorian calendar date
+inline
+std::int32_t navDaysFromCivil(std::int32_t year, unsigned month, unsigned day)
+{
+    year -= (month <= 2U) ? 1 : 0;
+    auto era = ((0 <= year) ? year : (year - 399)) / 400;
+    auto yoe = static_cast<unsigned>(year - (era * 400));
+    auto doy = (((153U * ((2U < month) ? (month - 3U) : (month + 9U))) + 2U) / 5U) + day - 1U;
+    auto doe = (yoe * 365U) + (yoe / 4U) - (yoe / 100U) + doy;
+    return (era * 146097) + static_cast<std::int32_t>(doe) - 719468;
+}
+
+}  // namespace details
+
+/// @brief Value returned by @ref navTowOffset() for the messages without @b iTOW.
+const std::size_t NoNavTowOffset = std::numeric_limits<std::size_t>::max();
+
+/// @brief Number of milliseconds in GPS week.
+const std::uint32_t NavMsPerWeek = 7U * 24U * 60U * 60U * 1000U;
+
+/// @brief Get offset of the @b iTOW field in the payload of the message.
+/// @details Most of the @b NAV messages start with @b iTOW, but some of them
+///     (@b NAV-HPPOSECEF, @b NAV-HPPOSLLH, @b NAV-RELPOSNED, @b NAV-ODO,
+///     @b NAV-SVIN) start with version and reserved fields, while others
+///     (@b NAV-EKFSTATUS, @b NAV-RESETODO) don't report it at all.
+///     The unknown (future) messages are not trusted either.
+/// @return Offset in bytes, @ref NoNavTowOffset if the message
+///     doesn't report @b iTOW.
+inline
+std::size_t navTowOffset(MsgId id)
+{
+    switch (id) {
+        case MsgId_NAV_POSECEF:
+        case MsgId_NAV_POSLLH:
+        case MsgId_NAV_STATUS:
+        case MsgId_NAV_DOP:
+        case MsgId_NAV_ATT:
+        case MsgId_NAV_SOL:
+        case MsgId_NAV_PVT:
+        case MsgId_NAV_VELECEF:
+        case MsgId_NAV_VELNED:
+        case MsgId_NAV_TIMEGPS:
+        case MsgId_NAV_TIMEUTC:
+        case MsgId_NAV_CLOCK:
+        case MsgId_NAV_TIMEGLO:
+        case MsgId_NAV_TIMEBDS:
+        case MsgId_NAV_TIMEGAL:
+        case MsgId_NAV_TIMELS:
+        case MsgId_NAV_SVINFO:
+        case MsgId_NAV_DGPS:
+        case MsgId_NAV_SBAS:
+        case MsgId_NAV_ORB:
+        case MsgId_NAV_SAT:
+        case MsgId_NAV_GEOFENCE:
+        case MsgId_NAV_AOPSTATUS:
+        case MsgId_NAV_EOE:
+            return 0U;
+        case MsgId_NAV_ODO:
+        case MsgId_NAV_HPPOSECEF:
+        case MsgId_NAV_HPPOSLLH:
+        case MsgId_NAV_SVIN:
+        case MsgId_NAV_RELPOSNED:
+            return 4U;
+        default:
+            break;
+    }
+    return NoNavTowOffset;
+}
+
+/// @brief Read GPS time of week (@b iTOW) of the navigation epoch from
+///     the message payload.
+/// @param[in] id ID of the message.
+/// @param[in] payload Pointer to the message payload.
+/// @param[in] len Length of the payload.
+/// @param[out] iTOW GPS time of week in milliseconds, not updated on failure.
+/// @return @b true if the message reports @b iTOW, @b false otherwise.
+/// @see navTowOffset()
+inline
+bool readNavTow(MsgId id, const std::uint8_t* payload, std::size_t len, std::uint32_t& iTOW)
+{
+    auto offset = navTowOffset(id);
+    if ((offset == NoNavTowOffset) || (len < (offset + sizeof(std::uint32_t)))) {
+        return false;
+    }
+
+    iTOW = details::navReadU32(payload + offset);
+    return true;
+}
+
+/// @brief Read GPS week of the navigation epoch from the message payload.
+/// @details The week is reported by @b NAV-TIMEGPS and @b NAV-SOL. For
+///     @b NAV-PVT it is calculated from the UTC date (when valid), using
+///     @b iTOW to resolve the week boundary.
+/// @param[in] id ID of the message.
+/// @param[in] payload Pointer to the message payload.
+/// @param[in] len Length of the payload.
+/// @param[out] week GPS week number, not updated on failure.
+/// @return @b true if the week was retrieved, @b false otherwise.
+inline
+bool readNavWeek(MsgId id, const std::uint8_t* payload, std::size_t len, std::uint16_t& week)
+{
+    static const std::size_t WeekOffset = 8U;
+    if ((id == MsgId_NAV_TIMEGPS) || (id == MsgId_NAV_SOL)) {
+        if (len < (WeekOffset + sizeof(std::uint16_t))) {
+            return false;
+        }
+
+        week = details::navReadU16(payload + WeekOffset);
+        return true;
+    }
+
+    if (id != MsgId_NAV_PVT) {
+        return false;
+    }
+
+    static const std::size_t YearOffset = 4U;
+    static const std::size_t MonthOffset = 6U;
+    static const std::size_t DayOffset = 7U;
+    static const std::size_t ValidOffset = 11U;
+    static const std::uint8_t ValidDateMask = 0x1;
+    static const std::uint32_t MsPerDay = NavMsPerWeek / 7U;
+    static const std::int32_t DaysPerWeek = 7;
+    if ((len <= ValidOffset) || ((payload[ValidOffset] & ValidDateMask) == 0U)) {
+        return false;
+    }
+
+    auto month = static_cast<unsigned>(payload[MonthOffset]);
+    auto day = static_cast<unsigned>(payload[DayOffset]);
+    if ((month < 1U) || (12U < month) || (day < 1U) || (31U < day)) {
+        return false;
+    }
+
+    // GPS time starts on 1980-01-06
+    auto days =
+        details::navDaysFromCivil(details::navReadU16(payload + YearOffset), month, day) -
+        details::navDaysFromCivil(1980, 1U, 6U);
+
+    // The UTC date lags GPS time by leap seconds, so the day of week
+    // derived from iTOW is used to find the start of the GPS week
+    auto towDay = static_cast<std::int32_t>(details::navReadU32(payload) / MsPerDay);
+    auto weekStart = days - towDay;
+    if ((weekStart + (DaysPerWeek / 2)) < 0) {
+        return false;
+    }
+
+    auto weekNum = (weekStart + (DaysPerWeek / 2)) / DaysPerWeek;
+    if (std::numeric_limits<std::uint16_t>::max() <= weekNum) {
+        return false;
+    }
+
+    week = static_cast<std::uint16_t>(weekNum);
+    return true;
+}
+
+/// @brief Tracker of the GPS time (week and time of week) of the navigation
+///     epochs in the stream of the raw frames.
+/// @details The time of week is updated using @ref readNavTow(), the week
+///     using @ref readNavWeek(). When the time of week wraps around (drops by
+///     more than half of the week) and the message doesn't report the
+///     week itself, the known week is incremented. As the result the time
+///     keeps increasing over the week rollover even if the week is reported
+///     rarely.
+///     @code
+///     ublox::NavTimeTracker tracker;
+///     splitter.forEach(buf, len,
+///         [&tracker, buf](const ublox::FrameInfo& info)
+///         {
+///             tracker.update(info.m_id, buf + info.m_offset + ublox::protocol::FrameHeaderLength, info.m_payloadLen);
+///             ... // use tracker.week() and tracker.iTOW()
+///         });
+///     @endcode
+class NavTimeTracker
+{
+public:
+    /// @brief Value of unknown week.
+    static const std::uint16_t UnknownWeek = std::numeric_limits<std::uint16_t>::max();
+
+    /// @brief Value of unknown time of week.
+    static const std::uint32_t UnknownTow = std::numeric_limits<std::uint32_t>::max();
+
+    /// @brief Default constructor, the time is unknown.
+    NavTimeTracker() = default;
+
+    /// @brief Constructor, starting from the known time.
+    NavTimeTracker(std::uint16_t week, std::uint32_t iTOW)
+      : m_week(week),
+        m_iTOW(iTOW)
+    {
+    }
+
+    /// @brief Get last known GPS week, @ref UnknownWeek if none.
+    std::uint16_t week() const
+    {
+        return m_week;
+    }
+
+    /// @brief Get last known GPS time of week in milliseconds, @ref UnknownTow if none.
+    std::uint32_t iTOW() const
+    {
+        return m_iTOW;
+    }
+
+    /// @brief Get GPS time in milliseconds since the start of week 0.
+    /// @details The unknown week is counted as week 0.
+    static std::uint64_t timeMs(std::uint16_t week, std::uint32_t iTOW)
+    {
+        if (week == UnknownWeek) {
+            week = 0U;
+        }
+        return (static_cast<std::uint64_t>(week) * NavMsPerWeek) + iTOW;
+    }
+
+    /// @brief Get last known GPS time in milliseconds since the start of week 0.
+    /// @details The unknown week is counted as week 0, the time of week
+    ///     is expected to be known.
+    std::uint64_t timeMs() const
+    {
+        return timeMs(m_week, m_iTOW);
+    }
+
+    /// @brief Update the time using the received message.
+    /// @param[in] id ID of the message.
+    /// @param[in] payload Pointer to the message payload.
+    /// @param[in] len Length of the payload.
+    /// @return @b true if the message reported @b iTOW, @b false otherwise.
+    bool update(MsgId id, const std::uint8_t* payload, std::size_t len)
+    {
+        auto iTOW = UnknownTow;
+        if (!readNavTow(id, payload, len, iTOW)) {
+            return false;
+        }
+
+        auto week = UnknownWeek;
+        if (readNavWeek(id, payload, len, week)) {
+            m_week = week;
+        }
+        else if ((m_week != UnknownWeek) &&
+                 (m_iTOW != UnknownTow) &&
+                 ((static_cast<std::uint64_t>(iTOW) + (NavMsPerWeek / 2U)) < m_iTOW)) {
+            ++m_week;
+        }
+
+        m_iTOW = iTOW;
+        return true;
+    }
+
+private:
+    std::uint16_t m_week = UnknownWeek;
+    std::uint32_t m_iTOW = UnknownTow;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,298 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of ublox::ParallelLogReader class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "MappedLog.h"
+
+namespace ublox
+{
+
+/// @brief Multi-threaded reader of the messages from the memory mapped log.
+/// @details Splits the log (ublox::MappedLog) into chunks of fixed length,
+///     which are decoded by the worker threads, every one using its own instance
+///     of the protocol stack. The worker of every chunk resynchronises
+///     on the first valid frame (checksum included) at or after the chunk
+///     beginning and decodes all the frames starting inside the chunk. The last
+///     frame may extend beyond the chunk end, the data is never copied.
+///
+///     The decoded messages are dispatched to the handler in the calling
+///     thread in the original file order. While doing so, the frames of every
+///     chunk are stitched with the preceding one: if the frame that straddles
+///     the chunk border is not followed by the frame the next chunk has been
+///     synchronised on (i.e. the latter was a false synchronisation inside
+///     the payload), the frames are re-read in the calling thread until both
+///     sequences meet. As the result the delivered messages are exactly the
+///     same as with ublox::MappedLog::readMessages().
+///
+///     Only limited number of chunks (twice the number of threads) are
+///     decoded ahead of the delivery, so the memory consumption doesn't depend
+///     on the size of the log.
+///     @code
+///     ublox::MappedLog log("capture.ubx");
+///     ublox::ParallelLogReader<ProtStack> reader(8);
+///     reader.readMessages(log, handler);
+///     @endcode
+/// @tparam TStack Protocol stack type, expected to be some variant of @ref ublox::Stack
+///     using dynamic memory allocation of the messages (no @b comms::option::InPlaceAllocation).
+///     The interface class of the input messages must use <b>const std::uint8_t*</b>
+///     as its read iterator.
+template <typename TStack>
+class ParallelLogReader
+{
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Type of the smart pointer to the decoded message.
+    using MsgPtr = typename Stack::MsgPtr;
+
+    /// @brief Default length of the chunk.
+    static const std::size_t DefaultChunkLength = 4U * 1024U * 1024U;
+
+    /// @brief Constructor.
+    /// @param[in] threads Number of the worker threads, 0 means
+    ///     number of hardware threads.
+    /// @param[in] chunkLength Length of the chunk the log is split into.
+    explicit ParallelLogReader(std::size_t threads = 0U, std::size_t chunkLength = DefaultChunkLength)
+      : m_threads(threads),
+        m_chunkLength(std::max(chunkLength, std::size_t(1U)))
+    {
+        if (m_threads == 0U) {
+            m_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        m_chunks.resize(m_threads * 2U);
+    }
+
+    ParallelLogReader(const ParallelLogReader&) = delete;
+    ParallelLogReader& operator=(const ParallelLogReader&) = delete;
+
+    /// @brief Get number of the worker threads.
+    std::size_t threads() const
+    {
+        return m_threads;
+    }
+
+    /// @brief Get length of the chunk.
+    std::size_t chunkLength() const
+    {
+        return m_chunkLength;
+    }
+
+    /// @brief Read all the messages from the log and dispatch them to the handler.
+    /// @details The handler is invoked in the calling thread only.
+    /// @param[in] log Memory mapped log.
+    /// @param[in] handler Handler object, the decoded messages are dispatched to.
+    /// @return Number of dispatched messages.
+    template <typename THandler>
+    std::size_t readMessages(const MappedLog& log, THandler& handler)
+    {
+        auto numOfChunks = (log.size() + m_chunkLength - 1U) / m_chunkLength;
+        m_log = &log;
+        m_numOfChunks = numOfChunks;
+        m_nextChunk = 0U;
+        m_delivered = 0U;
+        for (auto& chunk : m_chunks) {
+            chunk.m_done = false;
+        }
+
+        auto workers = std::min(m_threads, numOfChunks);
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+        for (auto idx = 0U; idx < workers; ++idx) {
+            threads.emplace_back(
+                [this]()
+                {
+                    run();
+                });
+        }
+
+        std::size_t count = 0U;
+        auto next = log.begin()->m_offset; // Offset of the next frame to deliver
+        for (auto chunkIdx = 0U; chunkIdx < numOfChunks; ++chunkIdx) {
+            auto& chunk = m_chunks[chunkIdx % m_chunks.size()];
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_cond.wait(
+                    guard,
+                    [&chunk]()
+                    {
+                        return chunk.m_done;
+                    });
+            }
+
+            count += deliver(chunk, chunkEnd(chunkIdx), next, handler);
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            chunk.m_entries.clear();
+            chunk.m_done = false;
+            ++m_delivered;
+            m_cond.notify_all();
+        }
+
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        m_log = nullptr;
+        return count;
+    }
+
+private:
+    struct Entry
+    {
+        std::size_t m_offset = 0U;
+        MsgPtr m_msg;
+    };
+
+    struct Chunk
+    {
+        std::vector<Entry> m_entries;
+        std::size_t m_next = 0U; // Offset of the frame following the chunk
+        bool m_done = false;
+    };
+
+    std::size_t chunkEnd(std::size_t chunkIdx) const
+    {
+        return std::min((chunkIdx + 1U) * m_chunkLength, m_log->size());
+    }
+
+    MsgPtr read(Stack& stack, const FrameInfo& info) const
+    {
+        using MsgType = typename MsgPtr::element_type;
+
+        MsgPtr msgPtr;
+        auto readIter = comms::readIteratorFor<MsgType>(m_log->frame(info));
+        auto es = stack.read(msgPtr, readIter, info.length());
+        if (es != comms::ErrorStatus::Success) {
+            msgPtr.reset();
+        }
+        return msgPtr;
+    }
+
+    void run()
+    {
+        Stack stack;
+        while (true) {
+            std::size_t chunkIdx = 0U;
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_cond.wait(
+                    guard,
+                    [this]()
+                    {
+                        return (m_numOfChunks <= m_nextChunk) ||
+                               (m_nextChunk < (m_delivered + m_chunks.size()));
+                    });
+
+                if (m_numOfChunks <= m_nextChunk) {
+                    return;
+                }
+
+                chunkIdx = m_nextChunk;
+                ++m_nextChunk;
+            }
+
+            // The chunk is not accessed by the calling thread until it's done
+            auto& chunk = m_chunks[chunkIdx % m_chunks.size()];
+            auto end = chunkEnd(chunkIdx);
+            auto iter = m_log->seek(chunkIdx * m_chunkLength);
+            for (; iter->m_offset < end; ++iter) {
+                chunk.m_entries.emplace_back();
+                auto& entry = chunk.m_entries.back();
+                entry.m_offset = iter->m_offset;
+                entry.m_msg = read(stack, *iter);
+            }
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            chunk.m_next = iter->m_offset;
+            chunk.m_done = true;
+            m_cond.notify_all();
+        }
+    }
+
+    template <typename THandler>
+    std::size_t deliver(Chunk& chunk, std::size_t end, std::size_t& next, THandler& handler)
+    {
+        std::size_t count = 0U;
+        auto& entries = chunk.m_entries;
+        auto entryIter = entries.begin();
+        while (next < end) {
+            entryIter =
+                std::find_if(
+                    entryIter, entries.end(),
+                    [next](const Entry& entry)
+                    {
+                        return next <= entry.m_offset;
+                    });
+
+            if ((entryIter != entries.end()) && (entryIter->m_offset == next)) {
+                for (; entryIter != entries.end(); ++entryIter) {
+                    if (entryIter->m_msg) {
+                        entryIter->m_msg->dispatch(handler);
+                        ++count;
+                    }
+                }
+
+                next = chunk.m_next;
+                break;
+            }
+
+            // Not synchronised with the chunk yet, follow the sequence of the frames
+            auto iter = m_log->seek(next);
+            auto msgPtr = read(m_stack, *iter);
+            if (msgPtr) {
+                msgPtr->dispatch(handler);
+                ++count;
+            }
+
+            ++iter;
+            next = iter->m_offset;
+        }
+        return count;
+    }
+
+    std::size_t m_threads = 0U;
+    std::size_t m_chunkLength = 0U;
+    std::vector<Chunk> m_chunks;
+    Stack m_stack;
+    const MappedLog* m_log = nullptr;
+    std::size_t m_numOfChunks = 0U;
+    std::size_t m_nextChunk = 0U;
+    std::size_t m_delivered = 0U;
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,294 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of selective read of the message fields.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MessageView.h"
+
+namespace ublox
+{
+
+/// @brief Selection of the message field to be read by ublox::Projection.
+/// @tparam TIdx Index of the field in the message (@b FieldIdx_* value).
+/// @tparam TMemberIdxs Optional indices of the members of the list element.
+///     If not empty, the field is expected to be a list of fixed length bundles
+///     (such as @b data field of ublox::message::NavSat), and only the
+///     specified members of every element are read.
+template <std::size_t TIdx, std::size_t... TMemberIdxs>
+struct Select
+{
+};
+
+namespace details
+{
+
+template <std::size_t... TIdxs>
+struct ProjIdxSeq
+{
+};
+
+template <bool TFound, typename TMembers>
+struct ProjFound
+{
+    static const bool Found = TFound;
+    using Members = TMembers;
+};
+
+template <std::size_t TIdx, typename... TSelects>
+struct ProjFind : public ProjFound<false, ProjIdxSeq<> >
+{
+};
+
+template <std::size_t TIdx, std::size_t TSelIdx, std::size_t... TMemberIdxs, typename... TRest>
+struct ProjFind<TIdx, Select<TSelIdx, TMemberIdxs...>, TRest...> : public
+    std::conditional<
+        TIdx == TSelIdx,
+        ProjFound<true, ProjIdxSeq<TMemberIdxs...> >,
+        ProjFind<TIdx, TRest...>
+    >::type
+{
+};
+
+template <typename TField>
+constexpr bool projIsFixed()
+{
+    return TField::minLength() == TField::maxLength();
+}
+
+template <typename TMembers>
+struct ProjMembersReader;
+
+template <>
+struct ProjMembersReader<ProjIdxSeq<> >
+{
+    template <typename TValue>
+    static void read(TValue&, const std::uint8_t*)
+    {
+    }
+};
+
+template <std::size_t TIdx, std::size_t... TRest>
+struct ProjMembersReader<ProjIdxSeq<TIdx, TRest...> >
+{
+    template <typename TValue>
+    static void read(TValue& members, const std::uint8_t* elem)
+    {
+        using Member = typename std::tuple_element<TIdx, TValue>::type;
+        const std::uint8_t* iter = elem + ViewFieldOffset<TValue, TIdx>::Value;
+        auto es = std::get<TIdx>(members).read(iter, Member::maxLength());
+        static_cast<void>(es);
+        GASSERT(es == comms::ErrorStatus::Success);
+        ProjMembersReader<ProjIdxSeq<TRest...> >::read(members, elem);
+    }
+};
+
+// Kinds of the field processing
+struct ProjReadTag {};
+struct ProjReadMembersTag {};
+struct ProjSkipTag {};
+struct ProjSkipRestTag {};
+struct ProjReadTempTag {};
+
+template <typename TField, typename TMembers>
+comms::ErrorStatus projRead(TField& field, const std::uint8_t*& iter, std::size_t& len, ProjReadTag)
+{
+    auto* begin = iter;
+    auto es = field.read(iter, len);
+    len -= static_cast<std::size_t>(iter - begin);
+    return es;
+}
+
+template <typename TField, typename TMembers>
+comms::ErrorStatus projRead(TField& field, const std::uint8_t*& iter, std::size_t& len, ProjReadMembersTag)
+{
+    using Elem = typename TField::ValueType::value_type;
+    static_assert(projIsFixed<Elem>(), "List element must have fixed length");
+    static const std::size_t ElemLen = Elem::maxLength();
+    static_assert(0U < ElemLen, "List element mustn't be empty");
+
+    auto count = len / ElemLen;
+    auto& elems = field.value();
+    elems.clear();
+    if (elems.max_size() < count) {
+        return comms::ErrorStatus::InvalidMsgData;
+    }
+
+    for (auto idx = 0U; idx < count; ++idx) {
+        elems.push_back(Elem());
+        ProjMembersReader<TMembers>::read(elems.back().value(), iter);
+        iter += ElemLen;
+    }
+
+    len -= count * ElemLen;
+    if (len != 0U) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+    return comms::ErrorStatus::Success;
+}
+
+// The skipped field may hold the value of the previous read of the message
+template <typename TField>
+void projReset(TField& field)
+{
+    field = TField();
+}
+
+template <typename TField, typename TMembers>
+comms::ErrorStatus projRead(TField& field, const std::uint8_t*& iter, std::size_t& len, ProjSkipTag)
+{
+    static const std::size_t FieldLen = TField::maxLength();
+    if (len < FieldLen) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    projReset(field);
+    iter += FieldLen;
+    len -= FieldLen;
+    return comms::ErrorStatus::Success;
+}
+
+template <typename TField, typename TMembers>
+comms::ErrorStatus projRead(TField& field, const std::uint8_t*& iter, std::size_t& len, ProjSkipRestTag)
+{
+    projReset(field);
+    iter += len;
+    len = 0U;
+    return comms::ErrorStatus::Success;
+}
+
+template <typename TField, typename TMembers>
+comms::ErrorStatus projRead(TField& field, const std::uint8_t*& iter, std::size_t& len, ProjReadTempTag)
+{
+    // Length of the variable field in the middle is unknown without reading it
+    TField temp;
+    projReset(field);
+    return projRead<TField, TMembers>(temp, iter, len, ProjReadTag());
+}
+
+template <typename TFields, std::size_t TIdx, std::size_t TCount, typename... TSelects>
+struct ProjFieldsReader
+{
+    static comms::ErrorStatus read(TFields& fields, const std::uint8_t*& iter, std::size_t& len)
+    {
+        using Field = typename std::tuple_element<TIdx, TFields>::type;
+        using Found = ProjFind<TIdx, TSelects...>;
+        using Members = typename Found::Members;
+        static const bool Last = (TIdx + 1U) == TCount;
+        static const bool Fixed = projIsFixed<Field>();
+        static const bool WholeField = std::is_same<Members, ProjIdxSeq<> >::value;
+        static_assert(WholeField || Last,
+            "Only the last field may be read partially");
+
+        using Tag =
+            typename std::conditional<
+                Found::Found,
+                typename std::conditional<WholeField, ProjReadTag, ProjReadMembersTag>::type,
+                typename std::conditional<
+                    Fixed,
+                    ProjSkipTag,
+                    typename std::conditional<Last, ProjSkipRestTag, ProjReadTempTag>::type
+                >::type
+            >::type;
+
+        auto es = projRead<Field, Members>(std::get<TIdx>(fields), iter, len, Tag());
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return ProjFieldsReader<TFields, TIdx + 1, TCount, TSelects...>::read(fields, iter, len);
+    }
+};
+
+template <typename TFields, std::size_t TCount, typename... TSelects>
+struct ProjFieldsReader<TFields, TCount, TCount, TSelects...>
+{
+    static comms::ErrorStatus read(TFields&, const std::uint8_t*&, std::size_t&)
+    {
+        return comms::ErrorStatus::Success;
+    }
+};
+
+}  // namespace details
+
+/// @brief Selective read of the message fields.
+/// @details Decodes only the selected fields of the message payload, the
+///     rest of the fields are skipped using their known serialisation length
+///     and are reset to their default values (also when the message object
+///     is reused after the full read). The message type remains the same, so
+///     the selected fields are accessed as usual. Members of the
+///     fixed length list elements may also be selected, other members of the
+///     elements are not decoded.
+///     @code
+///     using Msg = ublox::message::NavPvt<MyInputMessage>;
+///     using PvtProjection =
+///         ublox::Projection<
+///             ublox::Select<Msg::FieldIdx_iTOW>,
+///             ublox::Select<Msg::FieldIdx_fixType>,
+///             ublox::Select<Msg::FieldIdx_lon>,
+///             ublox::Select<Msg::FieldIdx_lat>,
+///             ublox::Select<Msg::FieldIdx_hMSL>
+///         >;
+///     Msg msg;
+///     auto es = PvtProjection::read(msg, payload, payloadLen);
+///
+///     using SatMsg = ublox::message::NavSat<MyInputMessage>;
+///     using Block = ublox::message::NavSatFields::block;
+///     using SatProjection =
+///         ublox::Projection<
+///             ublox::Select<SatMsg::FieldIdx_iTOW>,
+///             ublox::Select<SatMsg::FieldIdx_data, Block::FieldIdx_gnssId, Block::FieldIdx_svId, Block::FieldIdx_cno>
+///         >;
+///     @endcode
+///     The variable length fields that are not selected and are not the last
+///     ones in the message are still decoded (into temporary object) to find
+///     out their length. Any custom reading logic of the message (such as
+///     forcing the number of list elements from the preceding count field) is
+///     not applied, the list fields are read until the end of the payload.
+///     Only the last field in the message may be selected partially.
+/// @tparam TSelects Selected fields, each is ublox::Select.
+template <typename... TSelects>
+struct Projection
+{
+    /// @brief Read selected fields of the message payload.
+    /// @param[out] msg Message object, its fields are updated.
+    /// @param[in, out] iter Iterator to the payload, advanced past the read data.
+    /// @param[in] len Length of the payload.
+    /// @return Status of the operation.
+    template <typename TMsg>
+    static comms::ErrorStatus read(TMsg& msg, const std::uint8_t*& iter, std::size_t len)
+    {
+        using AllFields = typename TMsg::AllFields;
+        return
+            details::ProjFieldsReader<AllFields, 0U, std::tuple_size<AllFields>::value, TSelects...>::read(
+                msg.fields(), iter, len);
+    }
+};
+
+}  // namespace ublox
+
+
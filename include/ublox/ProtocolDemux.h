@@ -0,0 +1,298 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::ProtocolDemux class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "comms/comms.h"
+
+#include "protocol/Frame.h"
+#include "protocol/Crc24q.h"
+
+namespace ublox
+{
+
+/// @brief Demultiplexer of UBX, NMEA and RTCM3 traffic sharing the same port.
+/// @details The u-blox receiver can mix all three protocols on the same port
+///     (see @b inProtoMask and @b outProtoMask fields of @b CFG-PRT messages).
+///     The demultiplexer finds complete and valid frames of every protocol in
+///     a single pass over the data and reports them to the handler object, passing
+///     pointers into the provided buffer (no data is copied):
+///     @li UBX frames (<b>0xb5 0x62</b>, length and Fletcher checksum
+///         verified) are reported to <b>handleUbx(const std::uint8_t* frame, std::size_t len)</b>.
+///         The frame can be read by the protocol stack (ublox::Stack) as-is.
+///     @li NMEA sentences (<b>$...*hh\\r\\n</b>, checksum verified) are reported to
+///         <b>handleNmea(const std::uint8_t* sentence, std::size_t len)</b>. The
+///         reported sentence includes the leading '$' and the trailing "\r\n".
+///     @li RTCM3 frames (@b 0xd3 preamble, length and CRC-24Q verified) are reported to
+///         <b>handleRtcm3(const std::uint8_t* frame, std::size_t len)</b>.
+///
+///     Bytes that don't belong to any valid frame are skipped and counted.
+///     @code
+///     struct MyHandler
+///     {
+///         void handleUbx(const std::uint8_t* frame, std::size_t len)
+///         {
+///             ProtStack::MsgPtr msgPtr;
+///             auto es = protStack.read(msgPtr, frame, len);
+///             ...
+///         }
+///
+///         void handleNmea(const std::uint8_t* sentence, std::size_t len) {...}
+///         void handleRtcm3(const std::uint8_t* frame, std::size_t len) {...}
+///     };
+///
+///     auto consumed = demux.process(buf, bufLen, handler);
+///     // Keep the rest of the buffer until more data arrives
+///     @endcode
+class ProtocolDemux
+{
+public:
+    /// @brief Value of the first byte of the NMEA sentence.
+    static const std::uint8_t NmeaStart = '$';
+
+    /// @brief Maximal length of the NMEA sentence, including the leading '$' and trailing "\r\n".
+    /// @details The NMEA 0183 standard limits it to 82 characters, the extra space is
+    ///     reserved for proprietary sentences.
+    static const std::size_t NmeaMaxLength = 128U;
+
+    /// @brief Value of the RTCM3 frame preamble.
+    static const std::uint8_t Rtcm3Preamble = 0xd3;
+
+    /// @brief Length of RTCM3 frame header (preamble and length).
+    static const std::size_t Rtcm3HeaderLength = 3U;
+
+    /// @brief Length of RTCM3 frame CRC.
+    static const std::size_t Rtcm3CrcLength = 3U;
+
+    /// @brief Process the data.
+    /// @details The processing stops when the remaining data is the beginning of
+    ///     the frame that is not fully present in the buffer.
+    /// @param[in] buf Buffer to process.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @param[in] handler Handler object, see the class description for
+    ///     the required member functions.
+    /// @return Number of processed bytes. The unprocessed tail is expected to
+    ///     be presented again when more data is available.
+    template <typename THandler>
+    std::size_t process(const std::uint8_t* buf, std::size_t len, THandler&& handler)
+    {
+        auto* end = buf + len;
+        auto* iter = buf;
+        while (iter < end) {
+            auto remLen = static_cast<std::size_t>(end - iter);
+            std::size_t frameLen = 0U;
+            auto es = comms::ErrorStatus::ProtocolError;
+            switch (*iter) {
+            case protocol::SyncChar1:
+                es = protocol::checkFrame(iter, remLen);
+                if (es == comms::ErrorStatus::Success) {
+                    frameLen = protocol::frameLength(iter);
+                    handler.handleUbx(iter, frameLen);
+                    ++m_ubxFrames;
+                }
+                break;
+
+            case NmeaStart:
+                es = checkNmea(iter, remLen, frameLen);
+                if (es == comms::ErrorStatus::Success) {
+                    handler.handleNmea(iter, frameLen);
+                    ++m_nmeaSentences;
+                }
+                break;
+
+            case Rtcm3Preamble:
+                es = checkRtcm3(iter, remLen, frameLen);
+                if (es == comms::ErrorStatus::Success) {
+                    handler.handleRtcm3(iter, frameLen);
+                    ++m_rtcm3Frames;
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                break;
+            }
+
+            if (es != comms::ErrorStatus::Success) {
+                frameLen = skipGarbage(iter + 1, end) + 1U;
+                m_discarded += frameLen;
+            }
+
+            iter += frameLen;
+        }
+
+        return static_cast<std::size_t>(iter - buf);
+    }
+
+    /// @brief Get total number of reported UBX frames.
+    std::uint64_t ubxFrames() const
+    {
+        return m_ubxFrames;
+    }
+
+    /// @brief Get total number of reported NMEA sentences.
+    std::uint64_t nmeaSentences() const
+    {
+        return m_nmeaSentences;
+    }
+
+    /// @brief Get total number of reported RTCM3 frames.
+    std::uint64_t rtcm3Frames() const
+    {
+        return m_rtcm3Frames;
+    }
+
+    /// @brief Get total number of skipped bytes.
+    std::uint64_t discarded() const
+    {
+        return m_discarded;
+    }
+
+    /// @brief Reset all the statistics.
+    void resetStats()
+    {
+        m_ubxFrames = 0U;
+        m_nmeaSentences = 0U;
+        m_rtcm3Frames = 0U;
+        m_discarded = 0U;
+    }
+
+private:
+    static std::size_t skipGarbage(const std::uint8_t* begin, const std::uint8_t* end)
+    {
+        auto* iter = begin;
+        while (iter < end) {
+            auto byte = *iter;
+            if ((byte == protocol::SyncChar1) || (byte == NmeaStart) || (byte == Rtcm3Preamble)) {
+                break;
+            }
+            ++iter;
+        }
+        return static_cast<std::size_t>(iter - begin);
+    }
+
+    static std::uint8_t hexValue(std::uint8_t ch, bool& valid)
+    {
+        if (('0' <= ch) && (ch <= '9')) {
+            return static_cast<std::uint8_t>(ch - '0');
+        }
+
+        if (('A' <= ch) && (ch <= 'F')) {
+            return static_cast<std::uint8_t>((ch - 'A') + 10);
+        }
+
+        if (('a' <= ch) && (ch <= 'f')) {
+            return static_cast<std::uint8_t>((ch - 'a') + 10);
+        }
+
+        valid = false;
+        return 0U;
+    }
+
+    static comms::ErrorStatus checkNmea(const std::uint8_t* buf, std::size_t len, std::size_t& sentenceLen)
+    {
+        static const std::size_t SuffixLen = 5U; // "*hh\r\n"
+        std::uint8_t checksum = 0U;
+        auto maxLen = std::min(len, NmeaMaxLength);
+        for (auto idx = 1U; idx < maxLen; ++idx) {
+            auto ch = buf[idx];
+            if (ch == '*') {
+                if (len < (idx + SuffixLen)) {
+                    return comms::ErrorStatus::NotEnoughData;
+                }
+
+                bool valid = true;
+                auto expected =
+                    static_cast<std::uint8_t>(
+                        (hexValue(buf[idx + 1], valid) << 4U) | hexValue(buf[idx + 2], valid));
+                if ((!valid) ||
+                    (expected != checksum) ||
+                    (buf[idx + 3] != '\r') ||
+                    (buf[idx + 4] != '\n')) {
+                    return comms::ErrorStatus::ProtocolError;
+                }
+
+                sentenceLen = idx + SuffixLen;
+                return comms::ErrorStatus::Success;
+            }
+
+            // Only printable characters are allowed
+            if ((ch < ' ') || ('~' < ch) || (ch == '$')) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            checksum = static_cast<std::uint8_t>(checksum ^ ch);
+        }
+
+        if (len < NmeaMaxLength) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    static comms::ErrorStatus checkRtcm3(const std::uint8_t* buf, std::size_t len, std::size_t& frameLen)
+    {
+        if (len < Rtcm3HeaderLength) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        // 6 reserved bits must be 0
+        if ((buf[1] & 0xfcU) != 0U) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto msgLen =
+            (static_cast<std::size_t>(buf[1] & 0x3U) << 8U) |
+            static_cast<std::size_t>(buf[2]);
+        auto fullLen = Rtcm3HeaderLength + msgLen + Rtcm3CrcLength;
+        if (len < fullLen) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto crcPos = Rtcm3HeaderLength + msgLen;
+        auto expected =
+            (static_cast<std::uint32_t>(buf[crcPos]) << 16U) |
+            (static_cast<std::uint32_t>(buf[crcPos + 1]) << 8U) |
+            static_cast<std::uint32_t>(buf[crcPos + 2]);
+        if (protocol::crc24q(buf, crcPos) != expected) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        frameLen = fullLen;
+        return comms::ErrorStatus::Success;
+    }
+
+    std::uint64_t m_ubxFrames = 0U;
+    std::uint64_t m_nmeaSentences = 0U;
+    std::uint64_t m_rtcm3Frames = 0U;
+    std::uint64_t m_discarded = 0U;
+};
+
+}  // namespace ublox
+
+
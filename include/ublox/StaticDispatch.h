@@ -0,0 +1,133 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of functions dispatching messages to the handler
+///     without virtual calls.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "MsgId.h"
+#include "MsgIdTable.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TMessages, typename TMsgBase, typename THandler>
+struct StaticDispatchTable;
+
+template <typename... TMessages, typename TMsgBase, typename THandler>
+struct StaticDispatchTable<std::tuple<TMessages...>, TMsgBase, THandler>
+{
+    using DispatchFunc = void (*)(TMsgBase&, THandler&);
+
+    template <typename TMsg>
+    static void dispatchOne(TMsgBase& msg, THandler& handler)
+    {
+        using MsgType =
+            typename std::conditional<
+                std::is_const<TMsgBase>::value,
+                const TMsg,
+                TMsg
+            >::type;
+
+        static_assert(std::is_base_of<typename std::remove_const<TMsgBase>::type, TMsg>::value,
+            "Message type must be derived from the provided base");
+        handler.handle(static_cast<MsgType&>(msg));
+    }
+
+    static void dispatch(std::size_t idx, TMsgBase& msg, THandler& handler)
+    {
+        // Extra element avoids zero sized array for empty tuple
+        static const DispatchFunc Funcs[sizeof...(TMessages) + 1] = {&dispatchOne<TMessages>..., nullptr};
+        Funcs[idx](msg, handler);
+    }
+};
+
+}  // namespace details
+
+/// @brief Dispatch message to the handler using index of its type.
+/// @details Casts the message to the type with the provided index in
+///     @b TMessages tuple and calls appropriate @b handle() member function
+///     of the handler directly. The selection is done using compile time
+///     generated table of functions, one per message type, so
+///     the @b handle() functions can be inlined. The message interface
+///     doesn't need to define any virtual function, including
+///     @b comms::option::Handler.
+/// @tparam TMessages All the message types bundled in std::tuple.
+/// @param[in] idx Index of the actual message type in @b TMessages.
+/// @param[in] msg Reference to the message object via its interface
+///     (or any other base class).
+/// @param[in] handler Handler object.
+/// @pre @b idx is less than number of elements in @b TMessages.
+template <typename TMessages, typename TMsgBase, typename THandler>
+void dispatchByIndex(std::size_t idx, TMsgBase& msg, THandler& handler)
+{
+    GASSERT(idx < std::tuple_size<TMessages>::value);
+    details::StaticDispatchTable<TMessages, TMsgBase, THandler>::dispatch(idx, msg, handler);
+}
+
+/// @brief Dispatch message to the handler using its ID.
+/// @details Finds the message type using ublox::MsgIdTable in constant
+///     time and dispatches the message as @ref dispatchByIndex() does.
+///     Can be used when the ID of the message is known without asking the
+///     message object, for example from ublox::FrameInfo of the frame
+///     the message was read from:
+///     @code
+///     if (!ublox::dispatchStatic<AllInputMessages>(info.m_id, *msgPtr, handler)) {
+///         ... // Unknown or ambiguous ID
+///     }
+///     @endcode
+///     The ID alone doesn't identify the type of the message when multiple
+///     message types share it (such as ublox::message::CfgPrtUart and
+///     ublox::message::CfgPrtUsb, ublox::message::CfgMsg and
+///     ublox::message::CfgMsgCurrent or poll and data variants of the
+///     @b AID messages). Such messages are NOT dispatched, use
+///     @ref dispatchByIndex() with the index of the type resolved when the
+///     message was read (such as ublox::AnyInputMessage::index()) or the
+///     virtual @b dispatch() of the message interface instead.
+/// @tparam TMessages All the message types bundled in std::tuple. Every
+///     message must be defined with @b comms::option::StaticNumIdImpl option.
+/// @param[in] id ID of the message.
+/// @param[in] msg Reference to the message object via its interface
+///     (or any other base class).
+/// @param[in] handler Handler object.
+/// @return @b true if the message was dispatched, @b false if the ID is
+///     unknown or shared by multiple message types in @b TMessages.
+template <typename TMessages, typename TMsgBase, typename THandler>
+bool dispatchStatic(MsgId id, TMsgBase& msg, THandler& handler)
+{
+    using Table = MsgIdTable<TMessages>;
+    auto idx = Table::find(id);
+    if ((idx == Table::NotFound) || (Table::next(idx) != Table::NotFound)) {
+        return false;
+    }
+
+    dispatchByIndex<TMessages>(idx, msg, handler);
+    return true;
+}
+
+}  // namespace ublox
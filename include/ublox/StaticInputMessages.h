@@ -0,0 +1,259 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::StaticInputMessages bundle.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+#include "comms/comms.h"
+
+#include "InputMessages.h"
+
+namespace ublox
+{
+
+/// @brief Default capacities of the variable length fields used by
+///     ublox::StaticInputMessages.
+/// @details Every value is the maximal number of elements (characters for
+///     strings) the relevant field can hold. When the number of elements is
+///     determined by the preceding 1 byte counter, the capacity is the maximal
+///     value of the counter, so any valid message fits. Lists with 2 bytes counter
+///     and lists that occupy the rest of the payload use limits from the
+///     protocol specification where available and reasonable values otherwise.
+///     Messages with 2 bytes counter exceeding the capacity are rejected
+///     with @b comms::ErrorStatus::InvalidMsgData.
+///
+///     To use different values, inherit from this struct and
+///     override the relevant members:
+///     @code
+///     struct MyCapacities : public ublox::StaticCapacities
+///     {
+///         static const std::size_t NavSatData = 64;
+///     };
+///
+///     using MyInputMessages = ublox::StaticInputMessages<MyInputMessage, MyCapacities>;
+///     @endcode
+struct StaticCapacities
+{
+    static const std::size_t NavSvinfoData = 255; ///< NAV-SVINFO blocks, limited by @b numCh
+    static const std::size_t NavDgpsData = 255; ///< NAV-DGPS blocks, limited by @b numCh
+    static const std::size_t NavSbasData = 255; ///< NAV-SBAS blocks, limited by @b cnt
+    static const std::size_t NavOrbData = 255; ///< NAV-ORB blocks, limited by @b numSv
+    static const std::size_t NavSatData = 255; ///< NAV-SAT blocks, limited by @b numSvs
+    static const std::size_t NavGeofenceData = 255; ///< NAV-GEOFENCE blocks, limited by @b numFences
+    static const std::size_t RxmRawData = 255; ///< RXM-RAW blocks, limited by @b numSV
+    static const std::size_t RxmSfrbxDwrd = 16; ///< RXM-SFRBX data words, limited by valid range of @b numWords
+    static const std::size_t RxmMeasxData = 255; ///< RXM-MEASX blocks, limited by @b numSV
+    static const std::size_t RxmRawxData = 255; ///< RXM-RAWX blocks, limited by @b numMeas
+    static const std::size_t RxmSvsiData = 255; ///< RXM-SVSI blocks, limited by @b numSV
+    static const std::size_t RxmImesData = 255; ///< RXM-IMES blocks, limited by @b numTx
+    static const std::size_t InfStr = 256; ///< Text of INF-* messages
+    static const std::size_t CfgInfList = 8; ///< CFG-INF blocks, one per protocol
+    static const std::size_t CfgRinvData = 30; ///< CFG-RINV data bytes, as specified
+    static const std::size_t CfgGnssBlocksList = 255; ///< CFG-GNSS blocks, limited by @b numConfigBlocks
+    static const std::size_t CfgEsrcData = 255; ///< CFG-ESRC blocks, limited by @b numSources
+    static const std::size_t CfgDoscData = 255; ///< CFG-DOSC blocks, limited by @b numOsc
+    static const std::size_t CfgGeofenceData = 255; ///< CFG-GEOFENCE blocks, limited by @b numFences
+    static const std::size_t MonIoData = 8; ///< MON-IO blocks, one per I/O port
+    static const std::size_t MonVerExtensions = 16; ///< MON-VER extension strings
+    static const std::size_t MonPatchData = 32; ///< MON-PATCH blocks, limited by @b nEntries
+    static const std::size_t AidAlpsrvData = 1024; ///< AID-ALPSRV data bytes, limited by @b dataSize
+    static const std::size_t AidAlpsrvUpdateData = 512; ///< AID-ALPSRV update data words, limited by @b size
+    static const std::size_t TimSmeasData = 255; ///< TIM-SMEAS blocks, limited by @b numMeas
+    static const std::size_t EsfMeasData = 31; ///< ESF-MEAS data elements, limited by @b numMeas bits of @b flags
+    static const std::size_t EsfRawList = 64; ///< ESF-RAW data blocks
+    static const std::size_t EsfStatusData = 255; ///< ESF-STATUS blocks, limited by @b numSens
+    static const std::size_t MgaDbdData = 256; ///< MGA-DBD data bytes
+    static const std::size_t LogRetrievestringBytes = 256; ///< LOG-RETRIEVESTRING bytes, as specified
+};
+
+/// @brief All input messages (the ones that can be sent out from u-blox receiver)
+///     with fixed size storage for every variable length field.
+/// @details Same as ublox::InputMessages, but every list and string field
+///     is defined with @b comms::option::FixedSizeStorage option, i.e. uses
+///     @b comms::util::StaticVector or @b comms::util::StaticString as its
+///     inner storage and never allocates memory. The fields with fixed
+///     serialisation length use their exact length as capacity, the capacities
+///     of others are taken from @b TCaps.
+/// @tparam TMessage Common message interface class
+/// @tparam TCaps Capacities of the variable length fields, expected to be
+///     ublox::StaticCapacities or a struct derived from it.
+template <typename TMessage = Message, typename TCaps = StaticCapacities>
+using StaticInputMessages =
+    std::tuple<
+        message::NavPosecef<TMessage>,
+        message::NavPosllh<TMessage>,
+        message::NavStatus<TMessage>,
+        message::NavDop<TMessage>,
+        message::NavAtt<TMessage>,
+        message::NavSol<TMessage>,
+        message::NavPvt<TMessage>,
+        message::NavOdo<TMessage>,
+        message::NavVelecef<TMessage>,
+        message::NavVelned<TMessage>,
+        message::NavHpposecef<TMessage>,
+        message::NavHpposllh<TMessage>,
+        message::NavTimegps<TMessage>,
+        message::NavTimeutc<TMessage>,
+        message::NavClock<TMessage>,
+        message::NavTimeglo<TMessage>,
+        message::NavTimebds<TMessage>,
+        message::NavTimegal<TMessage>,
+        message::NavTimels<TMessage>,
+        message::NavSvinfo<TMessage, comms::option::FixedSizeStorage<TCaps::NavSvinfoData> >,
+        message::NavDgps<TMessage, comms::option::FixedSizeStorage<TCaps::NavDgpsData> >,
+        message::NavSbas<TMessage, comms::option::FixedSizeStorage<TCaps::NavSbasData> >,
+        message::NavOrb<TMessage, comms::option::FixedSizeStorage<TCaps::NavOrbData> >,
+        message::NavSat<TMessage, comms::option::FixedSizeStorage<TCaps::NavSatData> >,
+        message::NavGeofence<TMessage, comms::option::FixedSizeStorage<TCaps::NavGeofenceData> >,
+        message::NavSvin<TMessage>,
+        message::NavRelposned<TMessage>,
+        message::NavEkfstatus<TMessage>,
+        message::NavAopstatus<TMessage>,
+        message::NavAopstatusU8<TMessage>,
+        message::RxmRaw<TMessage, comms::option::FixedSizeStorage<TCaps::RxmRawData> >,
+        message::RxmSfrb<TMessage, comms::option::FixedSizeStorage<10> >,
+        message::RxmSfrbx<TMessage, comms::option::FixedSizeStorage<TCaps::RxmSfrbxDwrd> >,
+        message::RxmMeasx<TMessage, comms::option::FixedSizeStorage<TCaps::RxmMeasxData> >,
+        message::RxmRawx<TMessage, comms::option::FixedSizeStorage<TCaps::RxmRawxData> >,
+        message::RxmSvsi<TMessage, comms::option::FixedSizeStorage<TCaps::RxmSvsiData> >,
+        message::RxmAlm<TMessage, comms::option::FixedSizeStorage<8> >,
+        message::RxmEph<TMessage, comms::option::FixedSizeStorage<8> >,
+        message::RxmRtcm<TMessage>,
+        message::RxmRlmShort<TMessage>,
+        message::RxmRlmLong<TMessage>,
+        message::RxmImes<TMessage, comms::option::FixedSizeStorage<TCaps::RxmImesData> >,
+        message::InfError<TMessage, comms::option::FixedSizeStorage<TCaps::InfStr> >,
+        message::InfWarning<TMessage, comms::option::FixedSizeStorage<TCaps::InfStr> >,
+        message::InfNotice<TMessage, comms::option::FixedSizeStorage<TCaps::InfStr> >,
+        message::InfTest<TMessage, comms::option::FixedSizeStorage<TCaps::InfStr> >,
+        message::InfDebug<TMessage, comms::option::FixedSizeStorage<TCaps::InfStr> >,
+        message::AckNak<TMessage>,
+        message::AckAck<TMessage>,
+        message::CfgPrtUart<TMessage>,
+        message::CfgPrtUsb<TMessage>,
+        message::CfgPrtSpi<TMessage>,
+        message::CfgPrtDdc<TMessage>,
+        message::CfgMsg<TMessage, comms::option::FixedSizeStorage<6> >,
+        message::CfgMsgCurrent<TMessage>,
+        message::CfgInf<
+            TMessage,
+            comms::option::FixedSizeStorage<TCaps::CfgInfList>,
+            comms::option::FixedSizeStorage<message::CfgInfFields::infMsgMask_numOfValues>
+        >,
+        message::CfgDat<TMessage, comms::option::FixedSizeStorage<5> >,
+        message::CfgTp<TMessage>,
+        message::CfgRate<TMessage>,
+        message::CfgFxn<TMessage>,
+        message::CfgRxm<TMessage>,
+        message::CfgEkf<TMessage>,
+        message::CfgAnt<TMessage>,
+        message::CfgSbas<TMessage>,
+        message::CfgNmeaExt<TMessage>,
+        message::CfgNmea<TMessage>,
+        message::CfgUsb<TMessage, comms::option::FixedSizeStorage<31> >,
+        message::CfgTmode<TMessage>,
+        message::CfgOdo<TMessage>,
+        message::CfgNavx5<TMessage>,
+        message::CfgNav5<TMessage>,
+        message::CfgEsfgwt<TMessage>,
+        message::CfgTp5<TMessage>,
+        message::CfgPm<TMessage>,
+        message::CfgRinv<TMessage, comms::option::FixedSizeStorage<TCaps::CfgRinvData> >,
+        message::CfgItfm<TMessage>,
+        message::CfgPm2<TMessage>,
+        message::CfgTmode2<TMessage>,
+        message::CfgGnss<TMessage, comms::option::FixedSizeStorage<TCaps::CfgGnssBlocksList> >,
+        message::CfgLogfilter<TMessage>,
+        message::CfgHnr<TMessage>,
+        message::CfgEsrc<TMessage, comms::option::FixedSizeStorage<TCaps::CfgEsrcData> >,
+        message::CfgDosc<TMessage, comms::option::FixedSizeStorage<TCaps::CfgDoscData> >,
+        message::CfgSmgr<TMessage>,
+        message::CfgGeofence<TMessage, comms::option::FixedSizeStorage<TCaps::CfgGeofenceData> >,
+        message::CfgDgnss<TMessage>,
+        message::CfgTmode3<TMessage>,
+        message::CfgPms<TMessage>,
+        message::UpdSosRestored<TMessage>,
+        message::UpdSosAck<TMessage>,
+        message::MonIo<TMessage, comms::option::FixedSizeStorage<TCaps::MonIoData> >,
+        message::MonVer<
+            TMessage,
+            comms::option::FixedSizeStorage<29>,
+            comms::option::FixedSizeStorage<9>,
+            comms::option::FixedSizeStorage<29>,
+            comms::option::FixedSizeStorage<TCaps::MonVerExtensions>
+        >,
+        message::MonMsgpp<
+            TMessage,
+            comms::option::FixedSizeStorage<8>,
+            comms::option::FixedSizeStorage<6>
+        >,
+        message::MonRxbuf<TMessage, comms::option::FixedSizeStorage<6> >,
+        message::MonTxbuf<TMessage, comms::option::FixedSizeStorage<6> >,
+        message::MonHw<TMessage, comms::option::FixedSizeStorage<17> >,
+        message::MonHw2<TMessage>,
+        message::MonRxr<TMessage>,
+        message::MonPatch<TMessage, comms::option::FixedSizeStorage<TCaps::MonPatchData> >,
+        message::MonGnss<TMessage>,
+        message::MonSmgr<TMessage>,
+        message::AidIni<TMessage>,
+        message::AidHui<TMessage>,
+        message::AidAlm<TMessage, comms::option::FixedSizeStorage<8> >,
+        message::AidEph<TMessage, comms::option::FixedSizeStorage<8> >,
+        message::AidAlpsrv<TMessage, comms::option::FixedSizeStorage<TCaps::AidAlpsrvData> >,
+        message::AidAlpsrvUpdate<TMessage, comms::option::FixedSizeStorage<TCaps::AidAlpsrvUpdateData> >,
+        message::AidAopU8<TMessage, comms::option::FixedSizeStorage<64> >,
+        message::AidAop<
+            TMessage,
+            comms::option::FixedSizeStorage<59>,
+            comms::option::FixedSizeStorage<48 * 3>
+        >,
+        message::AidAlp<TMessage>,
+        message::AidAlpStatus<TMessage>,
+        message::TimTp<TMessage>,
+        message::TimTm2<TMessage>,
+        message::TimSvin<TMessage>,
+        message::TimVrfy<TMessage>,
+        message::TimDosc<TMessage>,
+        message::TimTos<TMessage>,
+        message::TimSmeas<TMessage, comms::option::FixedSizeStorage<TCaps::TimSmeasData> >,
+        message::TimVcocal<TMessage>,
+        message::TimFchg<TMessage>,
+        message::EsfMeas<TMessage, comms::option::FixedSizeStorage<TCaps::EsfMeasData> >,
+        message::EsfRaw<TMessage, comms::option::FixedSizeStorage<TCaps::EsfRawList> >,
+        message::EsfStatus<TMessage, comms::option::FixedSizeStorage<TCaps::EsfStatusData> >,
+        message::EsfIns<TMessage>,
+        message::MgaFlashAck<TMessage>,
+        message::MgaAck<TMessage>,
+        message::MgaDbd<TMessage, comms::option::FixedSizeStorage<TCaps::MgaDbdData> >,
+        message::LogInfo<TMessage>,
+        message::LogRetrievepos<TMessage>,
+        message::LogRetrievestring<TMessage, comms::option::FixedSizeStorage<TCaps::LogRetrievestringBytes> >,
+        message::LogFindtime<TMessage>,
+        message::LogRetrieveposextra<TMessage>,
+        message::SecSign<TMessage, comms::option::FixedSizeStorage<32> >,
+        message::SecUniqid<TMessage, comms::option::FixedSizeStorage<5> >,
+        message::HnrPvt<TMessage>
+    >;
+
+}  // namespace ublox
+
+
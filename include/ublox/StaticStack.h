@@ -0,0 +1,128 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::StaticStack class.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "Stack.h"
+#include "StaticInputMessages.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TMessages>
+struct LargestMessage;
+
+template <typename TMsg>
+struct LargestMessage<std::tuple<TMsg> >
+{
+    using Type = TMsg;
+};
+
+template <typename TFirst, typename TSecond, typename... TRest>
+struct LargestMessage<std::tuple<TFirst, TSecond, TRest...> >
+{
+    using RestLargest = typename LargestMessage<std::tuple<TSecond, TRest...> >::Type;
+    using Type =
+        typename std::conditional<
+            (sizeof(RestLargest) <= sizeof(TFirst)),
+            TFirst,
+            RestLargest
+        >::type;
+};
+
+}  // namespace details
+
+/// @brief Protocol stack that never allocates memory.
+/// @details Variant of ublox::Stack, which allocates message objects "in place"
+///     (@b comms::option::InPlaceAllocation) and uses fixed size storage for the
+///     payload data field (see @ref ublox_bare_metal). Combined with
+///     message types that don't use dynamic memory allocation (such as the default
+///     ublox::StaticInputMessages) it is suitable for environments where heap
+///     is not available or @b malloc is not allowed.
+///
+///     The RAM consumed by the stack is dominated by the storage of
+///     the largest message. It is reported at compile time and can be
+///     limited using @b TRamLimit template parameter:
+///     @code
+///     // Fails compilation if the stack object occupies more than 4KB
+///     using ProtStack = ublox::StaticStack<MyInputMessage, MyInputMessages, 4096>;
+///
+///     // Or check it explicitly
+///     using OtherProtStack = ublox::StaticStack<MyInputMessage>;
+///     static_assert(OtherProtStack::RamSize <= 8192, "Too much RAM");
+///     @endcode
+///     The @b LargestMessage type can be used to find out which message
+///     capacities need to be reduced.
+///     Note that only one message object can exist at a time, the message
+///     returned by the @b read() operation must be destructed
+///     before the next read.
+/// @tparam TMsgBase Interface class for all the @b input messages, same as for ublox::Stack.
+/// @tparam TMessages Types of all messages that this protocol stack must
+///     identify during read, bundled in std::tuple. Defaults to ublox::StaticInputMessages.
+/// @tparam TRamLimit Maximal allowed size of the protocol stack object in bytes,
+///     0 means no limit.
+template <
+    typename TMsgBase,
+    typename TMessages = StaticInputMessages<TMsgBase>,
+    std::size_t TRamLimit = 0U>
+class StaticStack : public
+    Stack<
+        TMsgBase,
+        TMessages,
+        comms::option::InPlaceAllocation,
+        comms::option::FixedSizeStorage<protocol::MaxPayloadLength>
+    >
+{
+    using Base =
+        Stack<
+            TMsgBase,
+            TMessages,
+            comms::option::InPlaceAllocation,
+            comms::option::FixedSizeStorage<protocol::MaxPayloadLength>
+        >;
+
+public:
+    /// @brief Type of the largest message in @b TMessages.
+    using LargestMessage = typename details::LargestMessage<TMessages>::Type;
+
+    /// @brief Size of the largest message object in bytes.
+    static const std::size_t MaxMessageSize = sizeof(LargestMessage);
+
+    /// @brief Size of the protocol stack object in bytes, including the
+    ///     storage area for the message object.
+    static const std::size_t RamSize = sizeof(Base);
+
+    static_assert((TRamLimit == 0U) || (RamSize <= TRamLimit),
+        "The protocol stack exceeds the RAM limit, check the LargestMessage type");
+};
+
+}  // namespace ublox
+
+
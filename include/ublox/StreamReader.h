@@ -0,0 +1,224 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::StreamReader class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <iterator>
+
+#include "comms/comms.h"
+
+#include "protocol/Resync.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+/// @brief Reader of the incoming stream of raw bytes.
+/// @details Accumulates the incoming data in the fixed capacity buffer and
+///     feeds it to the protocol stack (@ref ublox::Stack). Every
+///     successfully read message is dispatched to the provided handler object.
+///
+///     The buffer is a ring, which keeps a mirror copy of every byte at the
+///     distance of @b TCapacity. As the result the pending data is always accessible
+///     as a single contiguous range and the protocol stack reads it in place.
+///     Consumed data is never shifted and the buffer never reallocates.
+///     There are no dynamic memory allocations performed by this class. In case
+///     the protocol stack is defined with @b comms::option::InPlaceAllocation option
+///     (see @ref ublox_protocol_stack), the processing of the stream
+///     doesn't allocate any memory at all.
+///
+///     The reader doesn't depend on any I/O framework, the expected usage is:
+///     @code
+///     void onDataReceived(const std::uint8_t* data, std::size_t len)
+///     {
+///         while (0U < len) {
+///             auto accepted = reader.feed(data, len);
+///             data += accepted;
+///             len -= accepted;
+///             reader.poll();
+///         }
+///     }
+///     @endcode
+/// @tparam TStack Protocol stack type, expected to be some variant of @ref ublox::Stack.
+///     The interface class of the input messages must use <b>const std::uint8_t*</b>
+///     as its read iterator.
+/// @tparam THandler Type of the handler object, input messages are dispatched to.
+/// @tparam TCapacity Maximal amount of pending bytes. It also limits the
+///     maximal length of the frame that can be processed, longer frames are
+///     dropped. The reader occupies twice this amount of bytes.
+template <typename TStack, typename THandler, std::size_t TCapacity = protocol::MaxFrameLength>
+class StreamReader
+{
+    static_assert(0U < TCapacity, "Capacity mustn't be 0");
+
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Type of the message handler.
+    using Handler = THandler;
+
+    /// @brief Constructor.
+    /// @param[in] handler Reference to the handler object, the read messages
+    ///     are dispatched to. The object must outlive the reader.
+    explicit StreamReader(Handler& handler)
+      : m_handler(handler)
+    {
+    }
+
+    /// @brief Access the protocol stack.
+    /// @details Can be used to serialise output messages.
+    Stack& stack()
+    {
+        return m_stack;
+    }
+
+    /// @brief Access the protocol stack (const version).
+    const Stack& stack() const
+    {
+        return m_stack;
+    }
+
+    /// @brief Access the resynchronisation helper.
+    /// @details Can be used to retrieve the amount of discarded bytes.
+    const protocol::Resync& resync() const
+    {
+        return m_resync;
+    }
+
+    /// @brief Get the capacity of the buffer.
+    static constexpr std::size_t capacity()
+    {
+        return TCapacity;
+    }
+
+    /// @brief Get the amount of pending bytes.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @brief Get the amount of bytes that can be accepted by @ref feed().
+    std::size_t space() const
+    {
+        return TCapacity - m_size;
+    }
+
+    /// @brief Discard all the pending bytes.
+    void clear()
+    {
+        m_readPos = 0U;
+        m_size = 0U;
+    }
+
+    /// @brief Append received data.
+    /// @details Copies as much data as fits into the buffer.
+    /// @param[in] data Pointer to the received data.
+    /// @param[in] len Number of received bytes.
+    /// @return Number of accepted bytes. If it is less than @b len, @ref poll()
+    ///     needs to be called before feeding the rest.
+    std::size_t feed(const std::uint8_t* data, std::size_t len)
+    {
+        auto accepted = std::min(len, space());
+        auto remLen = accepted;
+        auto writePos = (m_readPos + m_size) % TCapacity;
+        while (0U < remLen) {
+            auto chunkLen = std::min(remLen, TCapacity - writePos);
+            std::memcpy(&m_buf[writePos], data, chunkLen);
+            std::memcpy(&m_buf[writePos + TCapacity], data, chunkLen);
+            data += chunkLen;
+            remLen -= chunkLen;
+            writePos = 0U;
+        }
+
+        m_size += accepted;
+        return accepted;
+    }
+
+    /// @brief Process the pending data.
+    /// @details Reads all the complete frames and dispatches the read
+    ///     messages to the handler. Incomplete frame at the end
+    ///     remains pending.
+    /// @return Number of dispatched messages.
+    std::size_t poll()
+    {
+        using MsgPtr = typename Stack::MsgPtr;
+        using MsgType = typename MsgPtr::element_type;
+
+        std::size_t count = 0U;
+        while (0U < m_size) {
+            const std::uint8_t* begin = &m_buf[m_readPos];
+            MsgPtr msgPtr;
+            auto begIter = comms::readIteratorFor<MsgType>(begin);
+            auto iter = begIter;
+            auto es = m_stack.read(msgPtr, iter, m_size);
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                if (m_size < TCapacity) {
+                    break;
+                }
+
+                // The frame is too long to fit into the buffer
+                es = comms::ErrorStatus::ProtocolError;
+            }
+
+            if (es == comms::ErrorStatus::ProtocolError) {
+                consume(m_resync.skip(begin, m_size));
+                continue;
+            }
+
+            if (es == comms::ErrorStatus::Success) {
+                GASSERT(msgPtr);
+                msgPtr->dispatch(m_handler);
+                ++count;
+            }
+
+            auto consumed = static_cast<std::size_t>(std::distance(begIter, iter));
+            if (consumed == 0U) {
+                consumed = m_resync.skip(begin, m_size);
+            }
+            consume(consumed);
+        }
+        return count;
+    }
+
+private:
+    void consume(std::size_t len)
+    {
+        GASSERT(len <= m_size);
+        m_readPos = (m_readPos + len) % TCapacity;
+        m_size -= len;
+    }
+
+    Handler& m_handler;
+    Stack m_stack;
+    protocol::Resync m_resync;
+    std::size_t m_readPos = 0U;
+    std::size_t m_size = 0U;
+    std::array<std::uint8_t, TCapacity * 2> m_buf;
+};
+
+}  // namespace ublox
+
+
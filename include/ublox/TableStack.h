@@ -0,0 +1,241 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::TableStack class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "Stack.h"
+#include "MsgIdTable.h"
+#include "FastRead.h"
+#include "protocol/Frame.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TMsgPtr, typename TMessages>
+struct TableStackFactory;
+
+template <typename TMsgPtr, typename... TMessages>
+struct TableStackFactory<TMsgPtr, std::tuple<TMessages...> >
+{
+    using ReadFunc = comms::ErrorStatus (*)(TMsgPtr&, const std::uint8_t*&, std::size_t);
+    using CreateFunc = TMsgPtr (*)();
+
+    template <typename TMsg>
+    static TMsgPtr create()
+    {
+        return TMsgPtr(new TMsg);
+    }
+
+    template <typename TMsg>
+    static comms::ErrorStatus read(TMsgPtr& msgPtr, const std::uint8_t*& iter, std::size_t len)
+    {
+        auto* msg = new TMsg;
+        msgPtr.reset(msg);
+        return fastRead(*msg, iter, len);
+    }
+
+    // Creates the message object and reads its payload
+    static comms::ErrorStatus read(std::size_t idx, TMsgPtr& msgPtr, const std::uint8_t*& iter, std::size_t len)
+    {
+        // Extra element avoids zero sized array for empty tuple
+        static const ReadFunc Funcs[sizeof...(TMessages) + 1] = {&read<TMessages>..., nullptr};
+        return Funcs[idx](msgPtr, iter, len);
+    }
+
+    // Creates the message object
+    static TMsgPtr create(std::size_t idx)
+    {
+        static const CreateFunc Funcs[sizeof...(TMessages) + 1] = {&create<TMessages>..., nullptr};
+        return Funcs[idx]();
+    }
+};
+
+}  // namespace details
+
+/// @brief Variant of ublox::Stack with table driven message creation.
+/// @details The default protocol stack (@ref ublox::Stack) finds the
+///     message type to create using binary search over the sorted list of
+///     message IDs, which involves multiple unpredictable branches for the
+///     large message sets (such as ublox::InputMessages or full list of
+///     messages in the @b cc_plugin). This class reads the contiguous
+///     frames directly: it validates the transport information (see
+///     ublox::protocol::checkFrame()), finds the message type using
+///     ublox::MsgIdTable in constant time and invokes the factory function
+///     of the message type using indexed table of function pointers.
+///     The payload of the message types with fixed layout is read using
+///     ublox::fastRead().
+///     If multiple message types share the same ID, they are tried in order
+///     of their appearance in @b TMessages until one of them reads successfully.
+///
+///     The read operation with iterators other than <b>const std::uint8_t*</b>
+///     as well as all the other operations (write, update, etc...) are
+///     forwarded to the ublox::Stack this class inherits from.
+/// @tparam TMsgBase Interface class for all the @b input messages, same as for ublox::Stack.
+/// @tparam TMessages Types of all messages that this protocol stack must
+///     identify during read, bundled in std::tuple.
+/// @tparam TDataFieldStorageOptions Same as for ublox::Stack.
+/// @note Only dynamic memory allocation for the message objects is supported.
+template <
+    typename TMsgBase,
+    typename TMessages,
+    typename TDataFieldStorageOptions = comms::option::EmptyOption>
+class TableStack : public
+    Stack<TMsgBase, TMessages, comms::option::EmptyOption, TDataFieldStorageOptions>
+{
+    using Base = Stack<TMsgBase, TMessages, comms::option::EmptyOption, TDataFieldStorageOptions>;
+    using Table = MsgIdTable<TMessages>;
+
+public:
+    /// @brief Type of smart pointer holding allocated message object.
+    using MsgPtr = typename Base::MsgPtr;
+
+    /// @brief Deserialise message from the input data sequence.
+    /// @details Has the same semantics as @b read() member function of the
+    ///     ublox::Stack.
+    /// @param[out] msgPtr Reference to smart pointer that will hold
+    ///     allocated message object.
+    /// @param[in, out] iter Input iterator, advanced past the read frame.
+    /// @param[in] size Size of the data in the sequence.
+    /// @param[out] missingSize If not nullptr and return value is
+    ///     comms::ErrorStatus::NotEnoughData it will contain minimal
+    ///     missing data length required for the successful read attempt.
+    /// @return Status of the operation.
+    template <typename TIter>
+    comms::ErrorStatus read(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<TIter, const std::uint8_t*>::value,
+                TableReadTag,
+                BaseReadTag
+            >::type;
+        return readInternal(msgPtr, iter, size, missingSize, Tag());
+    }
+
+    /// @brief Create message object given the ID of the message.
+    /// @details Has the same semantics as @b createMsg() member function of
+    ///     the ublox::Stack, but the message type is found in constant time.
+    /// @param[in] id ID of the message.
+    /// @param[in] idx Relative index of the message type with the same ID.
+    /// @return Smart pointer to the created message object, empty if
+    ///     the message type is not found.
+    MsgPtr createMsg(MsgId id, unsigned idx = 0U)
+    {
+        auto tIdx = Table::find(id);
+        while ((tIdx != Table::NotFound) && (0U < idx)) {
+            tIdx = Table::next(tIdx);
+            --idx;
+        }
+
+        if (tIdx == Table::NotFound) {
+            return MsgPtr();
+        }
+
+        return Factory::create(tIdx);
+    }
+
+private:
+    struct TableReadTag {};
+    struct BaseReadTag {};
+
+    using Factory = details::TableStackFactory<MsgPtr, TMessages>;
+
+    template <typename TIter>
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        BaseReadTag)
+    {
+        return Base::read(msgPtr, iter, size, missingSize);
+    }
+
+    comms::ErrorStatus readInternal(
+        MsgPtr& msgPtr,
+        const std::uint8_t*& iter,
+        std::size_t size,
+        std::size_t* missingSize,
+        TableReadTag)
+    {
+        auto* frame = iter;
+        auto es = protocol::checkFrame(frame, size);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            if (missingSize != nullptr) {
+                auto expLen = protocol::FrameOverheadLength;
+                if (protocol::FrameHeaderLength <= size) {
+                    expLen = protocol::frameLength(frame);
+                }
+                *missingSize = expLen - size;
+            }
+            return es;
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        // The frame is consumed from now on regardless of the read status
+        auto frameLen = protocol::frameLength(frame);
+        auto payloadLen = protocol::framePayloadLength(frame);
+        iter += frameLen;
+
+        auto idx = Table::find(protocol::frameMsgId(frame));
+        if (idx == Table::NotFound) {
+            return comms::ErrorStatus::InvalidMsgId;
+        }
+
+        do {
+            auto payloadIter = frame + protocol::FrameHeaderLength;
+            es = Factory::read(idx, msgPtr, payloadIter, payloadLen);
+            if (es == comms::ErrorStatus::Success) {
+                return es;
+            }
+
+            idx = Table::next(idx);
+        } while (idx != Table::NotFound);
+
+        msgPtr.reset();
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            // The whole frame is already consumed, the payload is too short
+            // for its message type (same as in MsgSizeLayer of ublox::Stack)
+            es = comms::ErrorStatus::ProtocolError;
+        }
+        return es;
+    }
+};
+
+}  // namespace ublox
+
+
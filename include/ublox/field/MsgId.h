@@ -22,8 +22,8 @@
 
 #include <cstdint>
 #include <limits>
-#include <algorithm>
-#include <utility>
+#include <cstddef>
+#include <type_traits>
 #include "comms/comms.h"
 #include "ublox/MsgId.h"
 
@@ -36,322 +36,386 @@ namespace field
 namespace details
 {
 
-struct MsgIdValueValidator
+template <std::size_t... TIdx>
+struct MsgIdIndexSeq
 {
-    template <typename TField>
-    bool operator()(const TField& field) const
-    {
-        using ValidateFunc = bool (*)(ublox::MsgId);
-        using FuncInfo = std::pair<std::uint8_t, ValidateFunc>;
-
-        static const FuncInfo Funcs[] = {
-            std::make_pair(classId(MsgId_NAV_POSECEF), &MsgIdValueValidator::validateNav),
-            std::make_pair(classId(MsgId_RXM_RAW), &MsgIdValueValidator::validateRxm),
-            std::make_pair(classId(MsgId_INF_ERROR), &MsgIdValueValidator::validateInf),
-            std::make_pair(classId(MsgId_ACK_NAK), &MsgIdValueValidator::validateAck),
-            std::make_pair(classId(MsgId_CFG_PRT), &MsgIdValueValidator::validateCfg),
-            std::make_pair(classId(MsgId_UPD_SOS), &MsgIdValueValidator::validateUpd),
-            std::make_pair(classId(MsgId_MON_IO), &MsgIdValueValidator::validateMon),
-            std::make_pair(classId(MsgId_AID_REQ), &MsgIdValueValidator::validateAid),
-            std::make_pair(classId(MsgId_TIM_TP), &MsgIdValueValidator::validateTim),
-            std::make_pair(classId(MsgId_ESF_STATUS), &MsgIdValueValidator::validateEsf),
-            std::make_pair(classId(MsgId_MGA_GPS), &MsgIdValueValidator::validateMga),
-            std::make_pair(classId(MsgId_LOG_ERASE), &MsgIdValueValidator::validateLog),
-            std::make_pair(classId(MsgId_SEC_SIGN), &MsgIdValueValidator::validateSec),
-            std::make_pair(classId(MsgId_HNR_PVT), &MsgIdValueValidator::validateHnr),
-        };
-
-        ublox::MsgId id = field.value();
-        auto cId = classId(id);
-        auto iter =
-            std::lower_bound(
-                std::begin(Funcs), std::end(Funcs), cId,
-                [](const FuncInfo& info, std::uint8_t cIdParam) -> bool
-                {
-                    return info.first < cIdParam;
-                });
-        if ((iter == std::end(Funcs)) || (iter->first != cId)) {
-            return false;
-        }
-
-        return iter->second(id);
-    }
+    using Type = MsgIdIndexSeq<TIdx...>;
+};
 
-private:
-    static constexpr std::uint8_t classId(ublox::MsgId id)
-    {
-        return static_cast<std::uint8_t>(
-            (unsigned)id >> std::numeric_limits<std::uint8_t>::digits);
-    }
+template <typename TFirst, typename TSecond>
+struct MsgIdIndexSeqConcat;
 
-    static bool validateNav(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_NAV_POSECEF,
-            MsgId_NAV_POSLLH,
-            MsgId_NAV_STATUS,
-            MsgId_NAV_DOP,
-            MsgId_NAV_ATT,
-            MsgId_NAV_SOL,
-            MsgId_NAV_PVT,
-            MsgId_NAV_ODO,
-            MsgId_NAV_RESETODO,
-            MsgId_NAV_VELECEF,
-            MsgId_NAV_VELNED,
-            MsgId_NAV_HPPOSECEF,
-            MsgId_NAV_HPPOSLLH,
-            MsgId_NAV_TIMEGPS,
-            MsgId_NAV_TIMEUTC,
-            MsgId_NAV_CLOCK,
-            MsgId_NAV_TIMEGLO,
-            MsgId_NAV_TIMEBDS,
-            MsgId_NAV_TIMEGAL,
-            MsgId_NAV_TIMELS,
-            MsgId_NAV_SVINFO,
-            MsgId_NAV_DGPS,
-            MsgId_NAV_SBAS,
-            MsgId_NAV_ORB,
-            MsgId_NAV_SAT,
-            MsgId_NAV_GEOFENCE,
-            MsgId_NAV_SVIN,
-            MsgId_NAV_RELPOSNED,
-            MsgId_NAV_EKFSTATUS,
-            MsgId_NAV_AOPSTATUS,
-            MsgId_NAV_EOE
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+template <std::size_t... TFirst, std::size_t... TSecond>
+struct MsgIdIndexSeqConcat<MsgIdIndexSeq<TFirst...>, MsgIdIndexSeq<TSecond...> >
+{
+    using Type = MsgIdIndexSeq<TFirst..., (sizeof...(TFirst) + TSecond)...>;
+};
 
-    static bool validateRxm(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_RXM_RAW,
-            MsgId_RXM_SFRB,
-            MsgId_RXM_SFRBX,
-            MsgId_RXM_MEASX,
-            MsgId_RXM_RAWX,
-            MsgId_RXM_SVSI,
-            MsgId_RXM_ALM,
-            MsgId_RXM_EPH,
-            MsgId_RXM_RTCM,
-            MsgId_RXM_PMREQ,
-            MsgId_RXM_RLM,
-            MsgId_RXM_IMES,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+// Generates MsgIdIndexSeq<0, 1, ..., TSize - 1> with logarithmic instantiation depth
+template <std::size_t TSize>
+struct MakeMsgIdIndexSeq
+{
+    using Type =
+        typename MsgIdIndexSeqConcat<
+            typename MakeMsgIdIndexSeq<TSize / 2>::Type,
+            typename MakeMsgIdIndexSeq<TSize - (TSize / 2)>::Type
+        >::Type;
+};
 
-    static bool validateInf(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_INF_ERROR,
-            MsgId_INF_WARNING,
-            MsgId_INF_NOTICE,
-            MsgId_INF_TEST,
-            MsgId_INF_DEBUG
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+template <>
+struct MakeMsgIdIndexSeq<0U>
+{
+    using Type = MsgIdIndexSeq<>;
+};
 
-    static bool validateAck(ublox::MsgId id)
-    {
-        return (ublox::MsgId_ACK_NAK <= id) && (id <= MsgId_ACK_ACK);
-    }
+template <>
+struct MakeMsgIdIndexSeq<1U>
+{
+    using Type = MsgIdIndexSeq<0U>;
+};
 
-    static bool validateCfg(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_CFG_PRT,
-            MsgId_CFG_MSG,
-            MsgId_CFG_INF,
-            MsgId_CFG_RST,
-            MsgId_CFG_DAT,
-            MsgId_CFG_TP,
-            MsgId_CFG_RATE,
-            MsgId_CFG_CFG,
-            MsgId_CFG_FXN,
-            MsgId_CFG_RXM,
-            MsgId_CFG_EKF,
-            MsgId_CFG_ANT,
-            MsgId_CFG_SBAS,
-            MsgId_CFG_NMEA,
-            MsgId_CFG_USB,
-            MsgId_CFG_TMODE,
-            MsgId_CFG_ODO,
-            MsgId_CFG_NVS,
-            MsgId_CFG_NAVX5,
-            MsgId_CFG_NAV5,
-            MsgId_CFG_ESFGWT,
-            MsgId_CFG_TP5,
-            MsgId_CFG_PM,
-            MsgId_CFG_RINV,
-            MsgId_CFG_ITFM,
-            MsgId_CFG_PM2,
-            MsgId_CFG_TMODE2,
-            MsgId_CFG_GNSS,
-            MsgId_CFG_LOGFILTER,
-            MsgId_CFG_TXSLOT,
-            MsgId_CFG_PWR,
-            MsgId_CFG_HNR,
-            MsgId_CFG_ESRC,
-            MsgId_CFG_DOSC,
-            MsgId_CFG_SMGR,
-            MsgId_CFG_GEOFENCE,
-            MsgId_CFG_DGNSS,
-            MsgId_CFG_TMODE3,
-            MsgId_CFG_FIXSEED,
-            MsgId_CFG_DYNSEED,
-            MsgId_CFG_PMS
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+// Sorted list of all the valid message IDs
+template <typename T = void>
+struct MsgIdValidIds
+{
+    static constexpr ublox::MsgId Values[] = {
+        MsgId_NAV_POSECEF,
+        MsgId_NAV_POSLLH,
+        MsgId_NAV_STATUS,
+        MsgId_NAV_DOP,
+        MsgId_NAV_ATT,
+        MsgId_NAV_SOL,
+        MsgId_NAV_PVT,
+        MsgId_NAV_ODO,
+        MsgId_NAV_RESETODO,
+        MsgId_NAV_VELECEF,
+        MsgId_NAV_VELNED,
+        MsgId_NAV_HPPOSECEF,
+        MsgId_NAV_HPPOSLLH,
+        MsgId_NAV_TIMEGPS,
+        MsgId_NAV_TIMEUTC,
+        MsgId_NAV_CLOCK,
+        MsgId_NAV_TIMEGLO,
+        MsgId_NAV_TIMEBDS,
+        MsgId_NAV_TIMEGAL,
+        MsgId_NAV_TIMELS,
+        MsgId_NAV_SVINFO,
+        MsgId_NAV_DGPS,
+        MsgId_NAV_SBAS,
+        MsgId_NAV_ORB,
+        MsgId_NAV_SAT,
+        MsgId_NAV_GEOFENCE,
+        MsgId_NAV_SVIN,
+        MsgId_NAV_RELPOSNED,
+        MsgId_NAV_EKFSTATUS,
+        MsgId_NAV_AOPSTATUS,
+        MsgId_NAV_EOE,
+
+        MsgId_RXM_RAW,
+        MsgId_RXM_SFRB,
+        MsgId_RXM_SFRBX,
+        MsgId_RXM_MEASX,
+        MsgId_RXM_RAWX,
+        MsgId_RXM_SVSI,
+        MsgId_RXM_ALM,
+        MsgId_RXM_EPH,
+        MsgId_RXM_RTCM,
+        MsgId_RXM_PMREQ,
+        MsgId_RXM_RLM,
+        MsgId_RXM_IMES,
+
+        MsgId_INF_ERROR,
+        MsgId_INF_WARNING,
+        MsgId_INF_NOTICE,
+        MsgId_INF_TEST,
+        MsgId_INF_DEBUG,
+
+        MsgId_ACK_NAK,
+        MsgId_ACK_ACK,
+
+        MsgId_CFG_PRT,
+        MsgId_CFG_MSG,
+        MsgId_CFG_INF,
+        MsgId_CFG_RST,
+        MsgId_CFG_DAT,
+        MsgId_CFG_TP,
+        MsgId_CFG_RATE,
+        MsgId_CFG_CFG,
+        MsgId_CFG_FXN,
+        MsgId_CFG_RXM,
+        MsgId_CFG_EKF,
+        MsgId_CFG_ANT,
+        MsgId_CFG_SBAS,
+        MsgId_CFG_NMEA,
+        MsgId_CFG_USB,
+        MsgId_CFG_TMODE,
+        MsgId_CFG_ODO,
+        MsgId_CFG_NVS,
+        MsgId_CFG_NAVX5,
+        MsgId_CFG_NAV5,
+        MsgId_CFG_ESFGWT,
+        MsgId_CFG_TP5,
+        MsgId_CFG_PM,
+        MsgId_CFG_RINV,
+        MsgId_CFG_ITFM,
+        MsgId_CFG_PM2,
+        MsgId_CFG_TMODE2,
+        MsgId_CFG_GNSS,
+        MsgId_CFG_LOGFILTER,
+        MsgId_CFG_TXSLOT,
+        MsgId_CFG_PWR,
+        MsgId_CFG_HNR,
+        MsgId_CFG_ESRC,
+        MsgId_CFG_DOSC,
+        MsgId_CFG_SMGR,
+        MsgId_CFG_GEOFENCE,
+        MsgId_CFG_DGNSS,
+        MsgId_CFG_TMODE3,
+        MsgId_CFG_FIXSEED,
+        MsgId_CFG_DYNSEED,
+        MsgId_CFG_PMS,
+
+        MsgId_UPD_SOS,
+
+        MsgId_MON_IO,
+        MsgId_MON_VER,
+        MsgId_MON_MSGPP,
+        MsgId_MON_RXBUF,
+        MsgId_MON_TXBUF,
+        MsgId_MON_HW,
+        MsgId_MON_HW2,
+        MsgId_MON_RXR,
+        MsgId_MON_PATCH,
+        MsgId_MON_GNSS,
+        MsgId_MON_SMGR,
+
+        MsgId_AID_REQ,
+        MsgId_AID_INI,
+        MsgId_AID_HUI,
+        MsgId_AID_DATA,
+        MsgId_AID_ALM,
+        MsgId_AID_EPH,
+        MsgId_AID_ALPSRV,
+        MsgId_AID_AOP,
+        MsgId_AID_ALP,
+
+        MsgId_TIM_TP,
+        MsgId_TIM_TM2,
+        MsgId_TIM_SVIN,
+        MsgId_TIM_VRFY,
+        MsgId_TIM_DOSC,
+        MsgId_TIM_TOS,
+        MsgId_TIM_SMEAS,
+        MsgId_TIM_VCOCAL,
+        MsgId_TIM_FCHG,
+        MsgId_TIM_HOC,
+
+        MsgId_ESF_MEAS,
+        MsgId_ESF_RAW,
+        MsgId_ESF_STATUS,
+        MsgId_ESF_INS,
+
+        MsgId_MGA_GPS,
+        MsgId_MGA_GAL,
+        MsgId_MGA_BDS,
+        MsgId_MGA_QZSS,
+        MsgId_MGA_GLO,
+        MsgId_MGA_ANO,
+        MsgId_MGA_FLASH,
+        MsgId_MGA_INI,
+        MsgId_MGA_ACK,
+        MsgId_MGA_DBD,
+
+        MsgId_LOG_ERASE,
+        MsgId_LOG_STRING,
+        MsgId_LOG_CREATE,
+        MsgId_LOG_INFO,
+        MsgId_LOG_RETRIEVE,
+        MsgId_LOG_RETRIEVEPOS,
+        MsgId_LOG_RETRIEVESTRING,
+        MsgId_LOG_FINDTIME,
+        MsgId_LOG_RETRIEVEPOSEXTRA,
+
+        MsgId_SEC_SIGN,
+        MsgId_SEC_UNIQID,
+
+        MsgId_HNR_PVT,
+    };
+
+    static const std::size_t Size = std::extent<decltype(Values)>::value;
+};
 
-    static bool validateUpd(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_UPD_SOS,
-        };
+template <typename T>
+constexpr ublox::MsgId MsgIdValidIds<T>::Values[];
 
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+static const std::size_t MsgIdBitsPerWord = std::numeric_limits<std::uint64_t>::digits;
+static const std::size_t MsgIdWordsPerClass =
+    (std::numeric_limits<std::uint8_t>::max() + 1U) / MsgIdBitsPerWord;
 
-    static bool validateMon(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_MON_IO,
-            MsgId_MON_VER,
-            MsgId_MON_MSGPP,
-            MsgId_MON_RXBUF,
-            MsgId_MON_TXBUF,
-            MsgId_MON_HW,
-            MsgId_MON_HW2,
-            MsgId_MON_RXR,
-            MsgId_MON_PATCH,
-            MsgId_MON_GNSS,
-            MsgId_MON_SMGR,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+inline
+constexpr std::uint8_t msgIdClassId(unsigned id)
+{
+    return static_cast<std::uint8_t>(id >> std::numeric_limits<std::uint8_t>::digits);
+}
 
-    static bool validateAid(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_AID_REQ,
-            MsgId_AID_INI,
-            MsgId_AID_HUI,
-            MsgId_AID_DATA,
-            MsgId_AID_ALM,
-            MsgId_AID_EPH,
-            MsgId_AID_ALPSRV,
-            MsgId_AID_AOP,
-            MsgId_AID_ALP
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+inline
+constexpr std::uint8_t msgIdLowId(unsigned id)
+{
+    return static_cast<std::uint8_t>(id & std::numeric_limits<std::uint8_t>::max());
+}
 
-    static bool validateTim(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_TIM_TP,
-            MsgId_TIM_TM2,
-            MsgId_TIM_SVIN,
-            MsgId_TIM_VRFY,
-            MsgId_TIM_DOSC,
-            MsgId_TIM_TOS,
-            MsgId_TIM_SMEAS,
-            MsgId_TIM_VCOCAL,
-            MsgId_TIM_FCHG,
-            MsgId_TIM_HOC,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+// The list of the valid IDs is expected to be sorted. The recursive functions
+// below split the range in halves to keep the constexpr evaluation depth low.
 
-    static bool validateEsf(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_ESF_MEAS,
-            MsgId_ESF_RAW,
-            MsgId_ESF_STATUS,
-            MsgId_ESF_INS,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+inline
+constexpr bool msgIdsSorted(std::size_t from, std::size_t to)
+{
+    return
+        ((to - from) <= 1U) ? true :
+        ((to - from) == 2U) ? (MsgIdValidIds<>::Values[from] < MsgIdValidIds<>::Values[from + 1]) :
+            (msgIdsSorted(from, from + ((to - from) / 2) + 1) &&
+             msgIdsSorted(from + ((to - from) / 2), to));
+}
+
+// Whether the ID with specified index is the first one of its class
+inline
+constexpr bool msgIdFirstOfClass(std::size_t idx)
+{
+    return
+        (idx == 0U) ||
+        (msgIdClassId(MsgIdValidIds<>::Values[idx - 1]) != msgIdClassId(MsgIdValidIds<>::Values[idx]));
+}
+
+// Number of distinct classes of the IDs in the range [from, to)
+inline
+constexpr std::size_t msgIdsClassCount(std::size_t from, std::size_t to)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ? (msgIdFirstOfClass(from) ? 1U : 0U) :
+            (msgIdsClassCount(from, from + ((to - from) / 2)) +
+             msgIdsClassCount(from + ((to - from) / 2), to));
+}
+
+// Index of the first ID of the class in the range [from, to), total number of IDs if not found
+inline
+constexpr std::size_t msgIdsFindClass(std::size_t from, std::size_t to, std::uint8_t cls)
+{
+    return
+        (to <= from) ? MsgIdValidIds<>::Size :
+        ((to - from) == 1U) ?
+            ((msgIdClassId(MsgIdValidIds<>::Values[from]) == cls) ? from : MsgIdValidIds<>::Size) :
+        (cls <= msgIdClassId(MsgIdValidIds<>::Values[from + ((to - from) / 2) - 1])) ?
+            msgIdsFindClass(from, from + ((to - from) / 2), cls) :
+            msgIdsFindClass(from + ((to - from) / 2), to, cls);
+}
+
+// Slot of the class mask, 0 is reserved for unknown classes
+inline
+constexpr std::uint8_t msgIdClassSlot(std::uint8_t cls)
+{
+    return
+        (msgIdsFindClass(0U, MsgIdValidIds<>::Size, cls) == MsgIdValidIds<>::Size) ? 0U :
+            static_cast<std::uint8_t>(
+                msgIdsClassCount(0U, msgIdsFindClass(0U, MsgIdValidIds<>::Size, cls)) + 1U);
+}
+
+// Class of the IDs in the range [from, to), that has specified zero based ordinal
+inline
+constexpr std::uint8_t msgIdsNthClass(std::size_t from, std::size_t to, std::size_t nth)
+{
+    return
+        ((to - from) == 1U) ? msgIdClassId(MsgIdValidIds<>::Values[from]) :
+        (nth < msgIdsClassCount(from, from + ((to - from) / 2))) ?
+            msgIdsNthClass(from, from + ((to - from) / 2), nth) :
+            msgIdsNthClass(
+                from + ((to - from) / 2), to,
+                nth - msgIdsClassCount(from, from + ((to - from) / 2)));
+}
+
+// Bits of the IDs in the range [from, to) of the class, that belong to the mask word
+inline
+constexpr std::uint64_t msgIdsMaskWord(std::size_t from, std::size_t to, std::uint8_t cls, std::size_t word)
+{
+    return
+        (to <= from) ? 0U :
+        ((to - from) == 1U) ?
+            (((msgIdClassId(MsgIdValidIds<>::Values[from]) == cls) &&
+              ((msgIdLowId(MsgIdValidIds<>::Values[from]) / MsgIdBitsPerWord) == word)) ?
+                (std::uint64_t(1U) << (msgIdLowId(MsgIdValidIds<>::Values[from]) % MsgIdBitsPerWord)) :
+                std::uint64_t(0U)) :
+            (msgIdsMaskWord(from, from + ((to - from) / 2), cls, word) |
+             msgIdsMaskWord(from + ((to - from) / 2), to, cls, word));
+}
+
+inline
+constexpr std::uint64_t msgIdMaskWord(std::size_t idx)
+{
+    return
+        ((idx / MsgIdWordsPerClass) == 0U) ? 0U :
+            msgIdsMaskWord(
+                msgIdsFindClass(
+                    0U, MsgIdValidIds<>::Size,
+                    msgIdsNthClass(0U, MsgIdValidIds<>::Size, (idx / MsgIdWordsPerClass) - 1U)),
+                MsgIdValidIds<>::Size,
+                msgIdsNthClass(0U, MsgIdValidIds<>::Size, (idx / MsgIdWordsPerClass) - 1U),
+                idx % MsgIdWordsPerClass);
+}
+
+template <typename TSeq>
+struct MsgIdClassSlots;
+
+template <std::size_t... TIdx>
+struct MsgIdClassSlots<MsgIdIndexSeq<TIdx...> >
+{
+    static constexpr std::uint8_t Values[] = {msgIdClassSlot(static_cast<std::uint8_t>(TIdx))...};
+};
 
-    static bool validateMga(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_MGA_GPS,
-            MsgId_MGA_GAL,
-            MsgId_MGA_BDS,
-            MsgId_MGA_QZSS,
-            MsgId_MGA_GLO,
-            MsgId_MGA_ANO,
-            MsgId_MGA_FLASH,
-            MsgId_MGA_INI,
-            MsgId_MGA_ACK,
-            MsgId_MGA_DBD,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+template <std::size_t... TIdx>
+constexpr std::uint8_t MsgIdClassSlots<MsgIdIndexSeq<TIdx...> >::Values[];
 
+template <typename TSeq>
+struct MsgIdMasks;
 
-    static bool validateLog(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_LOG_ERASE,
-            MsgId_LOG_STRING,
-            MsgId_LOG_CREATE,
-            MsgId_LOG_INFO,
-            MsgId_LOG_RETRIEVE,
-            MsgId_LOG_RETRIEVEPOS,
-            MsgId_LOG_RETRIEVESTRING,
-            MsgId_LOG_FINDTIME,
-            MsgId_LOG_RETRIEVEPOSEXTRA,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
-    }
+template <std::size_t... TIdx>
+struct MsgIdMasks<MsgIdIndexSeq<TIdx...> >
+{
+    static constexpr std::uint64_t Values[] = {msgIdMaskWord(TIdx)...};
+};
 
-    static bool validateSec(ublox::MsgId id)
-    {
-        static const ublox::MsgId IDs[] = {
-            MsgId_SEC_SIGN,
-            MsgId_SEC_UNIQID,
-        };
+template <std::size_t... TIdx>
+constexpr std::uint64_t MsgIdMasks<MsgIdIndexSeq<TIdx...> >::Values[];
 
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
+/// @brief Validator of the message ID value.
+/// @details Every known class has its own 256 bit mask of valid IDs, generated
+///     at compile time from the list of valid IDs. The validation is a
+///     lookup of the class mask followed by a single bit test.
+struct MsgIdValueValidator
+{
+    template <typename TField>
+    bool operator()(const TField& field) const
+    {
+        return isValid(field.value());
     }
 
-    static bool validateHnr(ublox::MsgId id)
+    static bool isValid(ublox::MsgId id)
     {
-        static const ublox::MsgId IDs[] = {
-            MsgId_HNR_PVT,
-        };
-
-        auto iter = std::lower_bound(std::begin(IDs), std::end(IDs), id);
-        return (iter != std::end(IDs)) && (*iter == id);
+        using ClassSlots =
+            MsgIdClassSlots<MakeMsgIdIndexSeq<std::numeric_limits<std::uint8_t>::max() + 1U>::Type>;
+        using Masks =
+            MsgIdMasks<MakeMsgIdIndexSeq<(NumOfClasses + 1U) * MsgIdWordsPerClass>::Type>;
+
+        auto low = msgIdLowId(id);
+        auto word =
+            Masks::Values[
+                (ClassSlots::Values[msgIdClassId(id)] * MsgIdWordsPerClass) +
+                (low / MsgIdBitsPerWord)];
+        return ((word >> (low % MsgIdBitsPerWord)) & 0x1) != 0U;
     }
+
+private:
+    static const std::size_t NumOfClasses = msgIdsClassCount(0U, MsgIdValidIds<>::Size);
+    static_assert(msgIdsSorted(0U, MsgIdValidIds<>::Size), "The valid IDs must be sorted");
 };
 
 }  // namespace details
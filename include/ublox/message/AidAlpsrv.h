@@ -178,6 +178,10 @@ public:
 
         auto& dataSizeField = std::get<FieldIdx_dataSize>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
+        if (dataField.value().max_size() < dataSizeField.value()) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
         dataField.forceReadElemCount(dataSizeField.value());
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
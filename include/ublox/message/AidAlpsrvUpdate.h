@@ -160,6 +160,10 @@ public:
 
         auto& sizeField = std::get<FieldIdx_size>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
+        if (dataField.value().max_size() < sizeField.value()) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
         dataField.forceReadElemCount(sizeField.value());
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
@@ -183,6 +183,10 @@ public:
             return es;
         }
 
+        if (field_bytes().value().max_size() < field_byteCount().value()) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
         field_bytes().forceReadElemCount(field_byteCount().value());
         return Base::template readFieldsFrom<FieldIdx_bytes>(iter, len);
     }
@@ -202,6 +202,10 @@ public:
             return es;
         }
 
+        if (field_data().value().max_size() < field_nEntries().value()) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
         field_data().forceReadElemCount(field_nEntries().value());
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
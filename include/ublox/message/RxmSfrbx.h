@@ -164,6 +164,10 @@ public:
             return es;
         }
 
+        if (field_dwrd().value().max_size() < field_numWords().value()) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
         field_dwrd().forceReadElemCount(field_numWords().value());
         return Base::template readFieldsFrom<FieldIdx_dwrd>(iter, len);
     }
@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <limits>
 
+#include "details/Fletcher8.h"
+
 namespace ublox
 {
 
@@ -32,8 +34,14 @@ namespace protocol
 /// @brief Checksum calculator.
 /// @details Provided to @b comms::protocol::ChecksumLayer
 ///     when defining protocol stack (@ref ublox::Stack).
+///     The calculation over raw pointers to contiguous buffers is performed
+///     block-wise, using SIMD instructions when available
+///     (see @ref ublox::protocol::details::fletcher8()). Any other iterator is
+///     processed byte by byte. Define @b UBLOX_FLETCHER8_NO_SIMD to force
+///     portable implementation.
 struct ChecksumCalc
 {
+    /// @brief Calculate checksum of the bytes accessed via generic iterator.
     template <typename TIter>
     std::uint16_t operator()(TIter& iter, std::size_t len) const
     {
@@ -49,6 +57,27 @@ struct ChecksumCalc
             (static_cast<std::uint16_t>(ckB) << std::numeric_limits<std::uint8_t>::digits) |
             ckA;
     }
+
+    /// @brief Calculate checksum of the contiguous buffer.
+    std::uint16_t operator()(const std::uint8_t*& iter, std::size_t len) const
+    {
+        details::Fletcher8State state;
+        details::fletcher8(state, iter, len);
+        iter += len;
+        return
+            static_cast<std::uint16_t>(
+                ((state.m_ckB & 0xff) << std::numeric_limits<std::uint8_t>::digits) |
+                (state.m_ckA & 0xff));
+    }
+
+    /// @brief Calculate checksum of the contiguous buffer.
+    std::uint16_t operator()(std::uint8_t*& iter, std::size_t len) const
+    {
+        const std::uint8_t* constIter = iter;
+        auto result = operator()(constIter, len);
+        iter += len;
+        return result;
+    }
 };
 
 }  // namespace protocol
@@ -0,0 +1,81 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains calculation of CRC-24Q checksum used by RTCM3 protocol.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+struct Crc24qTable
+{
+    Crc24qTable()
+    {
+        for (auto idx = 0U; idx < m_values.size(); ++idx) {
+            std::uint32_t crc = static_cast<std::uint32_t>(idx) << 16U;
+            for (auto bit = 0U; bit < 8U; ++bit) {
+                crc <<= 1U;
+                if ((crc & 0x1000000U) != 0U) {
+                    crc ^= Poly;
+                }
+            }
+            m_values[idx] = crc & Mask;
+        }
+    }
+
+    static const std::uint32_t Poly = 0x1864cfbU;
+    static const std::uint32_t Mask = 0xffffffU;
+    std::array<std::uint32_t, 256> m_values;
+};
+
+}  // namespace details
+
+/// @brief Calculate CRC-24Q checksum.
+/// @details Used by RTCM3 protocol to protect the whole frame
+///     (preamble, length and message).
+/// @param[in] data Pointer to the data.
+/// @param[in] len Length of the data.
+/// @return Calculated 24 bit checksum.
+inline
+std::uint32_t crc24q(const std::uint8_t* data, std::size_t len)
+{
+    static const details::Crc24qTable Table;
+    std::uint32_t crc = 0U;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        auto tableIdx = ((crc >> 16U) ^ data[idx]) & 0xffU;
+        crc = ((crc << 8U) ^ Table.m_values[tableIdx]) & details::Crc24qTable::Mask;
+    }
+    return crc;
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
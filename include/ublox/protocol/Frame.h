@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains layout of the UBX frame and functions to inspect it
+///     without decoding the message payload.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "Resync.h"
+#include "ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief Offset of the class and ID bytes within the frame.
+const std::size_t FrameIdOffset = 2U;
+
+/// @brief Offset of the payload length (2 bytes, little endian) within the frame.
+const std::size_t FrameLengthOffset = 4U;
+
+/// @brief Length of the frame header: sync bytes, class, ID and payload length.
+const std::size_t FrameHeaderLength = 6U;
+
+/// @brief Length of the frame checksum (@b CK_A and @b CK_B).
+const std::size_t FrameChecksumLength = 2U;
+
+/// @brief Length of all the transport information wrapping the payload.
+const std::size_t FrameOverheadLength = FrameHeaderLength + FrameChecksumLength;
+
+/// @brief Maximal length of the message payload.
+const std::size_t MaxPayloadLength = 0xffff;
+
+/// @brief Maximal length of the single frame.
+const std::size_t MaxFrameLength = FrameOverheadLength + MaxPayloadLength;
+
+/// @brief Get message ID (class and ID) from the frame header.
+/// @pre The buffer contains at least @ref FrameHeaderLength bytes.
+inline
+MsgId frameMsgId(const std::uint8_t* frame)
+{
+    return static_cast<MsgId>(
+        (static_cast<unsigned>(frame[FrameIdOffset]) << std::numeric_limits<std::uint8_t>::digits) |
+        frame[FrameIdOffset + 1]);
+}
+
+/// @brief Get payload length from the frame header.
+/// @pre The buffer contains at least @ref FrameHeaderLength bytes.
+inline
+std::size_t framePayloadLength(const std::uint8_t* frame)
+{
+    return
+        static_cast<std::size_t>(frame[FrameLengthOffset]) |
+        (static_cast<std::size_t>(frame[FrameLengthOffset + 1]) << std::numeric_limits<std::uint8_t>::digits);
+}
+
+/// @brief Get full length of the frame from its header.
+/// @pre The buffer contains at least @ref FrameHeaderLength bytes.
+inline
+std::size_t frameLength(const std::uint8_t* frame)
+{
+    return framePayloadLength(frame) + FrameOverheadLength;
+}
+
+/// @brief Check the frame at the beginning of the buffer.
+/// @details Checks synchronisation bytes, that the buffer contains
+///     full frame and that the checksum is correct. The message payload
+///     is not decoded.
+/// @param[in] buf Buffer expected to start with the frame.
+/// @param[in] len Number of bytes in the buffer.
+/// @return @b comms::ErrorStatus::Success if the frame is valid,
+///     @b comms::ErrorStatus::NotEnoughData if the buffer contains only
+///     beginning of a valid frame, @b comms::ErrorStatus::ProtocolError
+///     if synchronisation bytes or checksum are wrong.
+inline
+comms::ErrorStatus checkFrame(const std::uint8_t* buf, std::size_t len)
+{
+    if ((0U < len) && (buf[0] != SyncChar1)) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    if ((1U < len) && (buf[1] != SyncChar2)) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    if (len < FrameHeaderLength) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    auto payloadLen = framePayloadLength(buf);
+    if (len < (payloadLen + FrameOverheadLength)) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    auto* iter = buf + FrameIdOffset;
+    auto checksum = ChecksumCalc()(iter, payloadLen + (FrameHeaderLength - FrameIdOffset));
+    auto expected =
+        static_cast<std::uint16_t>(
+            static_cast<unsigned>(iter[0]) |
+            (static_cast<unsigned>(iter[1]) << std::numeric_limits<std::uint8_t>::digits));
+    if (checksum != expected) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    return comms::ErrorStatus::Success;
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
@@ -0,0 +1,191 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of helper functions and classes used to
+///     resynchronise on the incoming stream of data.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && \
+    !defined(UBLOX_RESYNC_NO_SIMD)
+#define UBLOX_RESYNC_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(UBLOX_RESYNC_SSE2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief Value of the first synchronisation byte (<b>SYNC CHAR 1</b>).
+const std::uint8_t SyncChar1 = 0xb5;
+
+/// @brief Value of the second synchronisation byte (<b>SYNC CHAR 2</b>).
+const std::uint8_t SyncChar2 = 0x62;
+
+namespace details
+{
+
+#if defined(UBLOX_RESYNC_SSE2)
+
+inline
+unsigned lowestSetBitIdx(unsigned mask)
+{
+#if defined(_MSC_VER)
+    unsigned long idx = 0U;
+    _BitScanForward(&idx, mask);
+    return static_cast<unsigned>(idx);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+#endif // #if defined(UBLOX_RESYNC_SSE2)
+
+}  // namespace details
+
+/// @brief Find the beginning of the next frame candidate.
+/// @details Searches for the sequence of @ref SyncChar1 immediately followed
+///     by @ref SyncChar2. If the last byte in the buffer is @ref SyncChar1
+///     it is considered to be a beginning of the frame, which is not fully
+///     received yet.
+/// @param[in] begin Beginning of the buffer.
+/// @param[in] end End of the buffer.
+/// @return Pointer to the found position or @b end if not found.
+inline
+const std::uint8_t* findSync(const std::uint8_t* begin, const std::uint8_t* end)
+{
+    auto iter = begin;
+
+#if defined(UBLOX_RESYNC_SSE2)
+    static const std::size_t BlockLen = 16U;
+    auto sync1 = _mm_set1_epi8(static_cast<char>(SyncChar1));
+    auto sync2 = _mm_set1_epi8(static_cast<char>(SyncChar2));
+    while (BlockLen < static_cast<std::size_t>(end - iter)) {
+        auto first = _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(iter)));
+        auto second = _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(iter + 1)));
+        auto matches =
+            _mm_and_si128(
+                _mm_cmpeq_epi8(first, sync1),
+                _mm_cmpeq_epi8(second, sync2));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+        if (mask != 0U) {
+            return iter + details::lowestSetBitIdx(mask);
+        }
+        iter += BlockLen;
+    }
+#endif
+
+    while (iter < end) {
+        auto* found = static_cast<const std::uint8_t*>(
+            std::memchr(iter, SyncChar1, static_cast<std::size_t>(end - iter)));
+        if (found == nullptr) {
+            return end;
+        }
+
+        auto* next = found + 1;
+        if ((next == end) || (*next == SyncChar2)) {
+            return found;
+        }
+
+        iter = next;
+    }
+    return end;
+}
+
+/// @brief Resynchronisation helper.
+/// @details Used to skip the garbage bytes after the read operation
+///     of the protocol stack (@ref ublox::Stack) reported
+///     @b comms::ErrorStatus::ProtocolError (bad synchronisation bytes,
+///     bad checksum, etc...). Instead of discarding a single byte and
+///     re-running the whole chain of protocol layers it skips straight
+///     to the next frame candidate (see @ref findSync()), while accumulating
+///     the total number of discarded bytes.
+/// @code
+/// auto es = stack.read(msgPtr, iter, len);
+/// if (es == comms::ErrorStatus::ProtocolError) {
+///     consumed += resync.skip(buf + consumed, bufLen - consumed);
+///     continue;
+/// }
+/// @endcode
+class Resync
+{
+public:
+    /// @brief Skip to the next frame candidate.
+    /// @details The first byte in the buffer is considered to be the
+    ///     beginning of the invalid frame, the search starts from the
+    ///     second one.
+    /// @param[in] buf Buffer that starts with the rejected frame.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @return Number of bytes to skip, always greater than 0 unless
+    ///     @b len is 0.
+    std::size_t skip(const std::uint8_t* buf, std::size_t len)
+    {
+        if (len == 0U) {
+            return 0U;
+        }
+
+        auto* end = buf + len;
+        auto skipped = static_cast<std::size_t>(findSync(buf + 1, end) - buf);
+        m_discarded += skipped;
+        return skipped;
+    }
+
+    /// @brief Skip the bytes preceding the next frame candidate.
+    /// @details Unlike @ref skip(), the search starts from the first byte,
+    ///     i.e. returns 0 if the buffer already starts with the frame candidate.
+    /// @param[in] buf Buffer to search.
+    /// @param[in] len Number of bytes in the buffer.
+    /// @return Number of bytes to skip.
+    std::size_t skipGarbage(const std::uint8_t* buf, std::size_t len)
+    {
+        auto skipped = static_cast<std::size_t>(findSync(buf, buf + len) - buf);
+        m_discarded += skipped;
+        return skipped;
+    }
+
+    /// @brief Get total number of discarded bytes.
+    std::uint64_t discarded() const
+    {
+        return m_discarded;
+    }
+
+    /// @brief Reset the count of discarded bytes.
+    void resetDiscarded()
+    {
+        m_discarded = 0U;
+    }
+
+private:
+    std::uint64_t m_discarded = 0U;
+};
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
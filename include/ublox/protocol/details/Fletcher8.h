@@ -0,0 +1,271 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains block-wise implementation of 8-bit Fletcher checksum
+///     used by @ref ublox::protocol::ChecksumCalc.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define UBLOX_FLETCHER8_X86_DISPATCH
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define UBLOX_FLETCHER8_SSE2
+#endif
+
+#if defined(UBLOX_FLETCHER8_NO_SIMD)
+#undef UBLOX_FLETCHER8_X86_DISPATCH
+#undef UBLOX_FLETCHER8_SSE2
+#endif
+
+#if defined(UBLOX_FLETCHER8_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(UBLOX_FLETCHER8_X86_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+/// @brief Running state of the 8-bit Fletcher checksum.
+/// @details Both sums are kept in 32 bit accumulators. Only the lowest
+///     8 bits are significant, and since 2^32 is a multiple of 256, the
+///     natural wrap around of unsigned arithmetic doesn't influence the result.
+struct Fletcher8State
+{
+    std::uint32_t m_ckA = 0U; ///< Running @b CK_A sum
+    std::uint32_t m_ckB = 0U; ///< Running @b CK_B sum
+};
+
+/// @brief Process bytes one by one.
+inline
+void fletcher8Bytes(Fletcher8State& state, const std::uint8_t* data, std::size_t len)
+{
+    auto ckA = state.m_ckA;
+    auto ckB = state.m_ckB;
+    for (auto idx = 0U; idx < len; ++idx) {
+        ckA += data[idx];
+        ckB += ckA;
+    }
+    state.m_ckA = ckA;
+    state.m_ckB = ckB;
+}
+
+/// @brief Portable implementation, processing 8 bytes per iteration.
+/// @details For the block of @b N bytes <b>b[0] ... b[N-1]</b>:
+///     @li <b>CK_A += b[0] + ... + b[N-1]</b>
+///     @li <b>CK_B += N * CK_A + N * b[0] + (N - 1) * b[1] + ... + 1 * b[N-1]</b>
+inline
+void fletcher8Unrolled(Fletcher8State& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockLen = 8U;
+    auto ckA = state.m_ckA;
+    auto ckB = state.m_ckB;
+    while (BlockLen <= len) {
+        std::uint32_t b0 = data[0];
+        std::uint32_t b1 = data[1];
+        std::uint32_t b2 = data[2];
+        std::uint32_t b3 = data[3];
+        std::uint32_t b4 = data[4];
+        std::uint32_t b5 = data[5];
+        std::uint32_t b6 = data[6];
+        std::uint32_t b7 = data[7];
+
+        ckB += (BlockLen * ckA) +
+            (8 * b0) + (7 * b1) + (6 * b2) + (5 * b3) +
+            (4 * b4) + (3 * b5) + (2 * b6) + b7;
+        ckA += b0 + b1 + b2 + b3 + b4 + b5 + b6 + b7;
+
+        data += BlockLen;
+        len -= BlockLen;
+    }
+
+    state.m_ckA = ckA;
+    state.m_ckB = ckB;
+    fletcher8Bytes(state, data, len);
+}
+
+#if defined(UBLOX_FLETCHER8_SSE2)
+
+/// @brief SSE2 implementation, processing 16 bytes per iteration.
+inline
+void fletcher8Sse2(Fletcher8State& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockLen = 16U;
+    auto blocksCount = len / BlockLen;
+    if (blocksCount == 0U) {
+        fletcher8Bytes(state, data, len);
+        return;
+    }
+
+    auto zero = _mm_setzero_si128();
+    auto weightsLow = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    auto weightsHigh = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    auto sums = _mm_setzero_si128(); // sums of bytes (2 x 64 bit)
+    auto prefixSums = _mm_setzero_si128(); // sums of "sums" before every block (2 x 64 bit)
+    auto weighted = _mm_setzero_si128(); // weighted sums of bytes (4 x 32 bit)
+
+    for (auto blockIdx = 0U; blockIdx < blocksCount; ++blockIdx) {
+        auto bytes = _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(data)));
+        prefixSums = _mm_add_epi64(prefixSums, sums);
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(bytes, zero));
+        auto low = _mm_unpacklo_epi8(bytes, zero);
+        auto high = _mm_unpackhi_epi8(bytes, zero);
+        weighted = _mm_add_epi32(weighted, _mm_madd_epi16(low, weightsLow));
+        weighted = _mm_add_epi32(weighted, _mm_madd_epi16(high, weightsHigh));
+        data += BlockLen;
+    }
+
+    std::uint32_t sumsArr[4];
+    std::uint32_t prefixSumsArr[4];
+    std::uint32_t weightedArr[4];
+    _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(&sumsArr[0])), sums);
+    _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(&prefixSumsArr[0])), prefixSums);
+    _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(&weightedArr[0])), weighted);
+
+    auto processedLen = static_cast<std::uint32_t>(blocksCount * BlockLen);
+    state.m_ckB +=
+        (processedLen * state.m_ckA) +
+        (static_cast<std::uint32_t>(BlockLen) * (prefixSumsArr[0] + prefixSumsArr[2])) +
+        weightedArr[0] + weightedArr[1] + weightedArr[2] + weightedArr[3];
+    state.m_ckA += sumsArr[0] + sumsArr[2];
+
+    fletcher8Unrolled(state, data, len - processedLen);
+}
+
+#endif // #if defined(UBLOX_FLETCHER8_SSE2)
+
+#if defined(UBLOX_FLETCHER8_X86_DISPATCH)
+
+/// @brief AVX2 implementation, processing 32 bytes per iteration.
+/// @details Must be invoked only when CPU reports support for AVX2
+///     instructions, see @ref fletcher8().
+__attribute__((target("avx2")))
+inline
+void fletcher8Avx2(Fletcher8State& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockLen = 32U;
+    auto blocksCount = len / BlockLen;
+    if (blocksCount == 0U) {
+        fletcher8Bytes(state, data, len);
+        return;
+    }
+
+    auto zero = _mm256_setzero_si256();
+    auto ones = _mm256_set1_epi16(1);
+    auto weights =
+        _mm256_setr_epi8(
+            32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+            16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    auto sums = _mm256_setzero_si256(); // sums of bytes (4 x 64 bit)
+    auto prefixSums = _mm256_setzero_si256(); // sums of "sums" before every block (4 x 64 bit)
+    auto weighted = _mm256_setzero_si256(); // weighted sums of bytes (8 x 32 bit)
+
+    for (auto blockIdx = 0U; blockIdx < blocksCount; ++blockIdx) {
+        auto bytes = _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(data)));
+        prefixSums = _mm256_add_epi64(prefixSums, sums);
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, zero));
+        weighted =
+            _mm256_add_epi32(
+                weighted,
+                _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+        data += BlockLen;
+    }
+
+    std::uint32_t sumsArr[8];
+    std::uint32_t prefixSumsArr[8];
+    std::uint32_t weightedArr[8];
+    _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(&sumsArr[0])), sums);
+    _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(&prefixSumsArr[0])), prefixSums);
+    _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(&weightedArr[0])), weighted);
+
+    std::uint32_t weightedSum = 0U;
+    for (auto val : weightedArr) {
+        weightedSum += val;
+    }
+
+    auto processedLen = static_cast<std::uint32_t>(blocksCount * BlockLen);
+    state.m_ckB +=
+        (processedLen * state.m_ckA) +
+        (static_cast<std::uint32_t>(BlockLen) *
+            (prefixSumsArr[0] + prefixSumsArr[2] + prefixSumsArr[4] + prefixSumsArr[6])) +
+        weightedSum;
+    state.m_ckA += sumsArr[0] + sumsArr[2] + sumsArr[4] + sumsArr[6];
+
+    fletcher8Unrolled(state, data, len - processedLen);
+}
+
+#endif // #if defined(UBLOX_FLETCHER8_X86_DISPATCH)
+
+/// @brief Type of the function implementing the checksum calculation.
+using Fletcher8Func = void (*)(Fletcher8State&, const std::uint8_t*, std::size_t);
+
+/// @brief Select the best implementation supported by the running CPU.
+inline
+Fletcher8Func fletcher8Select()
+{
+#if defined(UBLOX_FLETCHER8_X86_DISPATCH)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &fletcher8Avx2;
+    }
+#endif
+
+#if defined(UBLOX_FLETCHER8_SSE2)
+    return &fletcher8Sse2;
+#else
+    return &fletcher8Unrolled;
+#endif
+}
+
+/// @brief Calculate 8-bit Fletcher checksum of the contiguous buffer.
+/// @details The implementation is selected at runtime upon first invocation.
+///     Short buffers are processed byte by byte, because the setup
+///     cost of vectorised implementation outweighs its benefit.
+inline
+void fletcher8(Fletcher8State& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t MinVectorLen = 32U;
+    if (len < MinVectorLen) {
+        fletcher8Unrolled(state, data, len);
+        return;
+    }
+
+    static const Fletcher8Func Func = fletcher8Select();
+    Func(state, data, len);
+}
+
+}  // namespace details
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
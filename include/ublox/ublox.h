@@ -25,4 +25,5 @@
 #include "MsgId.h"
 #include "Message.h"
 #include "Stack.h"
+#include "protocol/Resync.h"
 
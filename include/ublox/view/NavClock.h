@@ -0,0 +1,64 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-CLOCK message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavClock.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-CLOCK message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavClock : public MessageView<message::NavClock<> >
+{
+    using Base = MessageView<message::NavClock<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavClock(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavClockFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b clkB field (@ref message::NavClockFields).
+    UBLOX_VIEW_FIELD(clkB)
+
+    /// @brief Access @b clkD field (@ref message::NavClockFields).
+    UBLOX_VIEW_FIELD(clkD)
+
+    /// @brief Access @b tAcc field (@ref message::NavClockFields).
+    UBLOX_VIEW_FIELD(tAcc)
+
+    /// @brief Access @b fAcc field (@ref message::NavClockFields).
+    UBLOX_VIEW_FIELD(fAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
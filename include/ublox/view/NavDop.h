@@ -0,0 +1,73 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-DOP message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavDop.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-DOP message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavDop : public MessageView<message::NavDop<> >
+{
+    using Base = MessageView<message::NavDop<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavDop(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b gDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(gDOP)
+
+    /// @brief Access @b pDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(pDOP)
+
+    /// @brief Access @b tDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(tDOP)
+
+    /// @brief Access @b vDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(vDOP)
+
+    /// @brief Access @b hDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(hDOP)
+
+    /// @brief Access @b nDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(nDOP)
+
+    /// @brief Access @b eDOP field (@ref message::NavDopFields).
+    UBLOX_VIEW_FIELD(eDOP)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
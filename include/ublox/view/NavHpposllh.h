@@ -0,0 +1,88 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-HPPOSLLH message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavHpposllh.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-HPPOSLLH message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavHpposllh : public MessageView<message::NavHpposllh<> >
+{
+    using Base = MessageView<message::NavHpposllh<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavHpposllh(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b version field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(version)
+
+    /// @brief Access @b reserved1 field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(reserved1)
+
+    /// @brief Access @b iTOW field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b lon field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(lon)
+
+    /// @brief Access @b lat field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(lat)
+
+    /// @brief Access @b height field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(height)
+
+    /// @brief Access @b hMSL field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(hMSL)
+
+    /// @brief Access @b lonHp field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(lonHp)
+
+    /// @brief Access @b latHp field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(latHp)
+
+    /// @brief Access @b heightHp field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(heightHp)
+
+    /// @brief Access @b hMSLHp field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(hMSLHp)
+
+    /// @brief Access @b hAcc field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(hAcc)
+
+    /// @brief Access @b vAcc field (@ref message::NavHpposllhFields).
+    UBLOX_VIEW_FIELD(vAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,64 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-POSECEF message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavPosecef.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-POSECEF message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavPosecef : public MessageView<message::NavPosecef<> >
+{
+    using Base = MessageView<message::NavPosecef<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavPosecef(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavPosecefFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b ecefX field (@ref message::NavPosecefFields).
+    UBLOX_VIEW_FIELD(ecefX)
+
+    /// @brief Access @b ecefY field (@ref message::NavPosecefFields).
+    UBLOX_VIEW_FIELD(ecefY)
+
+    /// @brief Access @b ecefZ field (@ref message::NavPosecefFields).
+    UBLOX_VIEW_FIELD(ecefZ)
+
+    /// @brief Access @b pAcc field (@ref message::NavPosecefFields).
+    UBLOX_VIEW_FIELD(pAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,141 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-PVT message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavPvt.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-PVT message payload.
+/// @details See @ref ublox::MessageView for details.
+///     The optional @b headVeh, @b magDec and @b magAcc fields (ublox-8 only)
+///     are not accessible through the view.
+class NavPvt : public MessageView<message::NavPvt<> >
+{
+    using Base = MessageView<message::NavPvt<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavPvt(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b year field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(year)
+
+    /// @brief Access @b month field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(month)
+
+    /// @brief Access @b day field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(day)
+
+    /// @brief Access @b hour field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(hour)
+
+    /// @brief Access @b min field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(min)
+
+    /// @brief Access @b sec field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(sec)
+
+    /// @brief Access @b valid field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(valid)
+
+    /// @brief Access @b tAcc field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(tAcc)
+
+    /// @brief Access @b nano field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(nano)
+
+    /// @brief Access @b fixType field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(fixType)
+
+    /// @brief Access @b flags field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(flags)
+
+    /// @brief Access @b flags2 field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(flags2)
+
+    /// @brief Access @b numSV field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(numSV)
+
+    /// @brief Access @b lon field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(lon)
+
+    /// @brief Access @b lat field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(lat)
+
+    /// @brief Access @b height field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(height)
+
+    /// @brief Access @b hMSL field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(hMSL)
+
+    /// @brief Access @b hAcc field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(hAcc)
+
+    /// @brief Access @b vAcc field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(vAcc)
+
+    /// @brief Access @b velN field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(velN)
+
+    /// @brief Access @b velE field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(velE)
+
+    /// @brief Access @b velD field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(velD)
+
+    /// @brief Access @b gSpeed field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(gSpeed)
+
+    /// @brief Access @b headMot field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(headMot)
+
+    /// @brief Access @b sAcc field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(sAcc)
+
+    /// @brief Access @b headAcc field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(headAcc)
+
+    /// @brief Access @b pDOP field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(pDOP)
+
+    /// @brief Access @b reserved1 field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(reserved1)
+
+    /// @brief Access @b reserved2 field (@ref message::NavPvtFields).
+    UBLOX_VIEW_FIELD(reserved2)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
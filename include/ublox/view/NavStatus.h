@@ -0,0 +1,70 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-STATUS message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavStatus.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-STATUS message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavStatus : public MessageView<message::NavStatus<> >
+{
+    using Base = MessageView<message::NavStatus<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavStatus(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b gpsFix field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(gpsFix)
+
+    /// @brief Access @b flags field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(flags)
+
+    /// @brief Access @b fixStat field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(fixStat)
+
+    /// @brief Access @b flags2 field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(flags2)
+
+    /// @brief Access @b ttff field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(ttff)
+
+    /// @brief Access @b msss field (@ref message::NavStatusFields).
+    UBLOX_VIEW_FIELD(msss)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,67 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-TIMEGPS message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavTimegps.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-TIMEGPS message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavTimegps : public MessageView<message::NavTimegps<> >
+{
+    using Base = MessageView<message::NavTimegps<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavTimegps(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b fTOW field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(fTOW)
+
+    /// @brief Access @b week field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(week)
+
+    /// @brief Access @b leapS field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(leapS)
+
+    /// @brief Access @b valid field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(valid)
+
+    /// @brief Access @b tAcc field (@ref message::NavTimegpsFields).
+    UBLOX_VIEW_FIELD(tAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
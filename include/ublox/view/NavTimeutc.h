@@ -0,0 +1,79 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-TIMEUTC message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavTimeutc.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-TIMEUTC message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavTimeutc : public MessageView<message::NavTimeutc<> >
+{
+    using Base = MessageView<message::NavTimeutc<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavTimeutc(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b tAcc field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(tAcc)
+
+    /// @brief Access @b nano field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(nano)
+
+    /// @brief Access @b year field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(year)
+
+    /// @brief Access @b month field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(month)
+
+    /// @brief Access @b day field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(day)
+
+    /// @brief Access @b hour field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(hour)
+
+    /// @brief Access @b min field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(min)
+
+    /// @brief Access @b sec field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(sec)
+
+    /// @brief Access @b valid field (@ref message::NavTimeutcFields).
+    UBLOX_VIEW_FIELD(valid)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,64 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-VELECEF message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavVelecef.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-VELECEF message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavVelecef : public MessageView<message::NavVelecef<> >
+{
+    using Base = MessageView<message::NavVelecef<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavVelecef(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavVelecefFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b ecefVX field (@ref message::NavVelecefFields).
+    UBLOX_VIEW_FIELD(ecefVX)
+
+    /// @brief Access @b ecefVY field (@ref message::NavVelecefFields).
+    UBLOX_VIEW_FIELD(ecefVY)
+
+    /// @brief Access @b ecefVZ field (@ref message::NavVelecefFields).
+    UBLOX_VIEW_FIELD(ecefVZ)
+
+    /// @brief Access @b sAcc field (@ref message::NavVelecefFields).
+    UBLOX_VIEW_FIELD(sAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,76 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of NAV-VELNED message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/NavVelned.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of NAV-VELNED message payload.
+/// @details See @ref ublox::MessageView for details.
+class NavVelned : public MessageView<message::NavVelned<> >
+{
+    using Base = MessageView<message::NavVelned<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    NavVelned(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b iTOW field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(iTOW)
+
+    /// @brief Access @b velN field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(velN)
+
+    /// @brief Access @b velE field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(velE)
+
+    /// @brief Access @b velD field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(velD)
+
+    /// @brief Access @b speed field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(speed)
+
+    /// @brief Access @b gSpeed field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(gSpeed)
+
+    /// @brief Access @b heading field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(heading)
+
+    /// @brief Access @b sAcc field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(sAcc)
+
+    /// @brief Access @b cAcc field (@ref message::NavVelnedFields).
+    UBLOX_VIEW_FIELD(cAcc)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
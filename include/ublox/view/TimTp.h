@@ -0,0 +1,67 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of read-only view of TIM-TP message.
+
+#pragma once
+
+#include "ublox/MessageView.h"
+#include "ublox/message/TimTp.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Read-only view of TIM-TP message payload.
+/// @details See @ref ublox::MessageView for details.
+class TimTp : public MessageView<message::TimTp<> >
+{
+    using Base = MessageView<message::TimTp<> >;
+public:
+    /// @brief Constructor, see @ref ublox::MessageView::MessageView()
+    TimTp(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Access @b towMS field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(towMS)
+
+    /// @brief Access @b towSubMS field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(towSubMS)
+
+    /// @brief Access @b qErr field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(qErr)
+
+    /// @brief Access @b week field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(week)
+
+    /// @brief Access @b flags field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(flags)
+
+    /// @brief Access @b refInfo field (@ref message::TimTpFields).
+    UBLOX_VIEW_FIELD(refInfo)
+};
+
+}  // namespace view
+
+}  // namespace ublox
+
+
@@ -0,0 +1,117 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Checks that ublox::FrameBatch keeps the list of the sent frames after
+// the flush, so the received ACK-ACK / ACK-NAK messages can be correlated
+// with them, and that the next burst starts from an empty batch.
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "ublox/FrameBatch.h"
+#include "ublox/Message.h"
+#include "ublox/message/CfgPrtUsb.h"
+#include "ublox/message/CfgRate.h"
+#include "ublox/message/CfgMsgCurrent.h"
+
+namespace
+{
+
+using OutBuffer = std::vector<std::uint8_t>;
+using OutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::back_insert_iterator<OutBuffer> >,
+        comms::option::LengthInfoInterface
+    >;
+
+std::size_t errors = 0U;
+
+void check(bool cond, const char* what)
+{
+    if (!cond) {
+        std::cerr << "ERROR: " << what << std::endl;
+        ++errors;
+    }
+}
+
+} // namespace
+
+int main()
+{
+    ublox::message::CfgPrtUsb<OutMessage> cfgPrt;
+    ublox::message::CfgRate<OutMessage> cfgRate;
+    ublox::message::CfgMsgCurrent<OutMessage> cfgMsg;
+    cfgMsg.field_id().value() = ublox::MsgId_NAV_PVT;
+    cfgMsg.field_rate().value() = 1U;
+
+    ublox::FrameBatch batch;
+    check(batch.add(cfgPrt) == comms::ErrorStatus::Success, "CFG-PRT not added");
+    check(batch.add(cfgRate) == comms::ErrorStatus::Success, "CFG-RATE not added");
+    check(batch.add(cfgMsg) == comms::ErrorStatus::Success, "CFG-MSG not added");
+
+    OutBuffer sent;
+    std::size_t writes = 0U;
+    auto writeFunc =
+        [&sent, &writes](const std::uint8_t* data, std::size_t len)
+        {
+            sent.insert(sent.end(), data, data + len);
+            ++writes;
+        };
+
+    auto batchSize = batch.size();
+    batch.flush(writeFunc);
+    check(writes == 1U, "batch is not written with single call");
+    check(sent.size() == batchSize, "unexpected number of written bytes");
+    check(batch.sent(), "batch is not marked as sent");
+
+    // Replies are correlated after the flush
+    check(batch.frames().size() == 3U, "frames list is not retained after flush");
+    auto* rateInfo = batch.find(ublox::MsgId_CFG_RATE);
+    check(rateInfo != nullptr, "CFG-RATE is not found after flush");
+    if (rateInfo != nullptr) {
+        check(rateInfo == &batch.frames()[1], "wrong frame of CFG-RATE");
+        check(rateInfo->m_offset < sent.size(), "wrong offset of CFG-RATE");
+        check(rateInfo->m_payloadLen == cfgRate.length(), "wrong payload length of CFG-RATE");
+    }
+    check(batch.find(ublox::MsgId_CFG_MSG) != nullptr, "CFG-MSG is not found after flush");
+    check(batch.find(ublox::MsgId_NAV_PVT) == nullptr, "unexpected frame is found");
+
+    // Repeated flush doesn't send the same frames again
+    batch.flush(writeFunc);
+    check(writes == 1U, "sent batch is written again");
+
+    // Next burst discards the sent frames
+    check(batch.add(cfgRate) == comms::ErrorStatus::Success, "CFG-RATE not added to next burst");
+    check(!batch.sent(), "new burst is marked as sent");
+    check(batch.frames().size() == 1U, "frames of the sent batch are not discarded");
+    check(batch.find(ublox::MsgId_CFG_PRT) == nullptr, "CFG-PRT of the sent batch is found");
+
+    batch.clear();
+    check(batch.empty() && (batch.size() == 0U), "batch is not cleared");
+
+    if (errors != 0U) {
+        return 1;
+    }
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,137 @@
+//
+// Copyright 2015 - 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Checks that ublox::Projection resets the fields which are not selected,
+// when the message object is reused after the full read.
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/Projection.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavPvt.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using InNavPosllh = ublox::message::NavPosllh<InMessage>;
+using InNavPvt = ublox::message::NavPvt<InMessage>;
+
+std::size_t errors = 0U;
+
+void check(bool cond, const char* what)
+{
+    if (!cond) {
+        std::cerr << "ERROR: " << what << std::endl;
+        ++errors;
+    }
+}
+
+std::vector<std::uint8_t> makePayload(std::size_t len)
+{
+    std::vector<std::uint8_t> payload(len);
+    for (auto idx = 0U; idx < len; ++idx) {
+        payload[idx] = static_cast<std::uint8_t>(idx + 1U);
+    }
+    return payload;
+}
+
+template <typename TMsg>
+bool readFull(TMsg& msg, const std::vector<std::uint8_t>& payload)
+{
+    const std::uint8_t* iter = payload.data();
+    return msg.read(iter, payload.size()) == comms::ErrorStatus::Success;
+}
+
+template <typename TProjection, typename TMsg>
+bool readProjection(TMsg& msg, const std::vector<std::uint8_t>& payload)
+{
+    const std::uint8_t* iter = payload.data();
+    auto es = TProjection::read(msg, iter, payload.size());
+    return (es == comms::ErrorStatus::Success) && (iter == (payload.data() + payload.size()));
+}
+
+void checkNavPosllh()
+{
+    using Projection =
+        ublox::Projection<
+            ublox::Select<InNavPosllh::FieldIdx_iTOW>,
+            ublox::Select<InNavPosllh::FieldIdx_lat>
+        >;
+
+    auto payload = makePayload(28U);
+    InNavPosllh msg;
+    check(readFull(msg, payload), "NAV-POSLLH full read failed");
+    auto iTOW = msg.field_iTOW().value();
+    auto lat = msg.field_lat().value();
+    check(msg.field_lon().value() != InNavPosllh().field_lon().value(), "NAV-POSLLH lon is not read");
+
+    check(readProjection<Projection>(msg, payload), "NAV-POSLLH projection failed");
+    check(msg.field_iTOW().value() == iTOW, "NAV-POSLLH iTOW is not projected");
+    check(msg.field_lat().value() == lat, "NAV-POSLLH lat is not projected");
+    check(msg.field_lon().value() == InNavPosllh().field_lon().value(), "NAV-POSLLH lon is not reset");
+    check(msg.field_height().value() == InNavPosllh().field_height().value(), "NAV-POSLLH height is not reset");
+    check(msg.field_vAcc().value() == InNavPosllh().field_vAcc().value(), "NAV-POSLLH vAcc (last) is not reset");
+}
+
+void checkNavPvt()
+{
+    using Projection =
+        ublox::Projection<
+            ublox::Select<InNavPvt::FieldIdx_iTOW>,
+            ublox::Select<InNavPvt::FieldIdx_lon>
+        >;
+
+    auto payload = makePayload(92U);
+    InNavPvt msg;
+    check(readFull(msg, payload), "NAV-PVT full read failed");
+    auto iTOW = msg.field_iTOW().value();
+    auto lon = msg.field_lon().value();
+    check(msg.field_year().value() != InNavPvt().field_year().value(), "NAV-PVT year is not read");
+
+    check(readProjection<Projection>(msg, payload), "NAV-PVT projection failed");
+    check(msg.field_iTOW().value() == iTOW, "NAV-PVT iTOW is not projected");
+    check(msg.field_lon().value() == lon, "NAV-PVT lon is not projected");
+    check(msg.field_year().value() == InNavPvt().field_year().value(), "NAV-PVT year is not reset");
+    check(msg.field_lat().value() == InNavPvt().field_lat().value(), "NAV-PVT lat is not reset");
+    check(msg.field_pDOP().value() == InNavPvt().field_pDOP().value(), "NAV-PVT pDOP is not reset");
+    check(msg.field_magAcc().getMode() == InNavPvt().field_magAcc().getMode(), "NAV-PVT magAcc is not reset");
+}
+
+} // namespace
+
+int main()
+{
+    checkNavPosllh();
+    checkNavPvt();
+
+    if (errors != 0U) {
+        return 1;
+    }
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}